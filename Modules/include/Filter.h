@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+/*!
+ * \page filters Filter Modules
+ *
+ * The FIRFilter and BiquadFilter modules apply a digital filter to a stream of samples. The input is an array of
+ * nElements samples, which are treated as consecutive samples of one continuous stream. The filter state is carried
+ * over from one input update to the next, so splitting a stream into chunks does not change the result. Scalar
+ * streams are filtered by using nElements = 1.
+ *
+ * The filter coefficients are poll-type array inputs, so they can be changed at runtime. To load them from the
+ * configuration file, place variables with matching names and sizes in the ConfigReader, e.g.:
+ *   \verbatim
+     <configuration>
+       <module name="MyFilter">
+         <variable name="coefficients" type="float64">
+           <value i="0" v="0.25"/>
+           <value i="1" v="0.5"/>
+           <value i="2" v="0.25"/>
+         </variable>
+       </module>
+     </configuration>
+     \endverbatim
+ */
+
+#include "ApplicationModule.h"
+#include "ArrayAccessor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace ChimeraTK {
+
+  namespace detail {
+
+    /** Convert the filter result into the user type, with rounding if integral type. */
+    template<typename UserType>
+    UserType filterResultToUserType(double value) {
+      if constexpr(std::numeric_limits<UserType>::is_integer) {
+        return static_cast<UserType>(std::round(value));
+      }
+      else {
+        return static_cast<UserType>(value);
+      }
+    }
+
+  } // namespace detail
+
+  /********************************************************************************************************************/
+
+  /**
+   * Finite impulse response filter: output[n] = sum_k coefficients[k] * input[n - k], for k = 0 .. nTaps - 1.
+   *
+   * The last nTaps - 1 input samples are kept in a contiguous buffer in front of the new input samples, so the inner
+   * loop runs over contiguous memory without any wrap-around checks and can be vectorised by the compiler.
+   */
+  template<typename UserType>
+  struct FIRFilter : public ApplicationModule {
+    FIRFilter(EntityOwner* owner, const std::string& name, const std::string& description, size_t nElements,
+        size_t nTaps, HierarchyModifier hierarchyModifier = HierarchyModifier::none,
+        const std::unordered_set<std::string>& tags = {})
+    : ApplicationModule(owner, name, description, hierarchyModifier, tags),
+      input(this, "input", "", nElements, "Input samples"), output(this, "output", "", nElements, "Filtered samples"),
+      coefficients(this, "coefficients", "", nTaps, "FIR filter coefficients, starting with the newest sample") {
+      if(nTaps == 0) {
+        throw ChimeraTK::logic_error("FIRFilter '" + name + "': The number of taps must be at least 1.");
+      }
+    }
+
+    FIRFilter() = default;
+
+    ArrayPushInput<UserType> input;
+    ArrayOutput<UserType> output;
+    ArrayPollInput<double> coefficients;
+
+    void mainLoop() override {
+      const size_t nElements = input.getNElements();
+      const size_t nTaps = coefficients.getNElements();
+      _samples.assign(nTaps - 1 + nElements, 0.);
+      _result.resize(nElements);
+
+      while(true) {
+        coefficients.read();
+
+        // append the new samples behind the history
+        for(size_t i = 0; i < nElements; ++i) _samples[nTaps - 1 + i] = double(input[i]);
+
+        // The coefficients are reversed once per update, so the inner loop runs forward over both arrays.
+        _reversed.assign(coefficients.rbegin(), coefficients.rend());
+        for(size_t i = 0; i < nElements; ++i) {
+          const double* x = _samples.data() + i;
+          double sum = 0.;
+          for(size_t k = 0; k < nTaps; ++k) sum += _reversed[k] * x[k];
+          _result[i] = detail::filterResultToUserType<UserType>(sum);
+        }
+
+        // keep the last nTaps - 1 samples as history for the next update
+        std::copy(_samples.end() - long(nTaps - 1), _samples.end(), _samples.begin());
+
+        // hand over the result buffer to the output without copying
+        output.swap(_result);
+        output.write();
+
+        // wait for new input value (at the end, since we want to process the initial values first)
+        input.read();
+      }
+    }
+
+   protected:
+    /** History of nTaps - 1 old samples followed by the current input samples */
+    std::vector<double> _samples;
+
+    /** Coefficients in reversed order */
+    std::vector<double> _reversed;
+
+    /** Buffer for the result, swapped with the output buffer */
+    std::vector<UserType> _result;
+  };
+
+  /********************************************************************************************************************/
+
+  /**
+   * Infinite impulse response filter built from a cascade of nSections second-order sections ("biquads").
+   *
+   * The coefficients array contains 5 values per section: b0, b1, b2, a1, a2, with the transfer function
+   * H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2). The sections are implemented in transposed direct form
+   * II. The filter state (two values per section) is reset when the coefficients change.
+   *
+   * The input buffer is taken over from the input accessor and handed over to the output accessor after filtering, so
+   * no buffers are allocated or copied between the accessors. The samples pass through all sections in double
+   * precision, section by section over the whole array.
+   */
+  template<typename UserType>
+  struct BiquadFilter : public ApplicationModule {
+    BiquadFilter(EntityOwner* owner, const std::string& name, const std::string& description, size_t nElements,
+        size_t nSections, HierarchyModifier hierarchyModifier = HierarchyModifier::none,
+        const std::unordered_set<std::string>& tags = {})
+    : ApplicationModule(owner, name, description, hierarchyModifier, tags),
+      input(this, "input", "", nElements, "Input samples"), output(this, "output", "", nElements, "Filtered samples"),
+      coefficients(this, "coefficients", "", 5 * nSections,
+          "Biquad coefficients b0, b1, b2, a1, a2 for each section (a0 is normalised to 1)") {
+      if(nSections == 0) {
+        throw ChimeraTK::logic_error("BiquadFilter '" + name + "': The number of sections must be at least 1.");
+      }
+    }
+
+    BiquadFilter() = default;
+
+    ArrayPushInput<UserType> input;
+    ArrayOutput<UserType> output;
+    ArrayPollInput<double> coefficients;
+
+    void mainLoop() override {
+      const size_t nElements = input.getNElements();
+      const size_t nSections = coefficients.getNElements() / 5;
+      _state.assign(2 * nSections, 0.);
+      _samples.resize(nElements);
+      _buffer.resize(nElements);
+
+      while(true) {
+        coefficients.read();
+        const auto& currentCoefficients = static_cast<const std::vector<double>&>(coefficients);
+        if(_lastCoefficients != currentCoefficients) {
+          _lastCoefficients = currentCoefficients;
+          std::fill(_state.begin(), _state.end(), 0.);
+        }
+
+        // take over the input buffer (the input will receive a new buffer with the next read anyway)
+        input.swap(_buffer);
+        for(size_t i = 0; i < nElements; ++i) _samples[i] = double(_buffer[i]);
+
+        for(size_t s = 0; s < nSections; ++s) {
+          const double* c = _lastCoefficients.data() + 5 * s;
+          const double b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+          double z1 = _state[2 * s], z2 = _state[2 * s + 1];
+          for(auto& x : _samples) {
+            double y = b0 * x + z1;
+            z1 = b1 * x - a1 * y + z2;
+            z2 = b2 * x - a2 * y;
+            x = y;
+          }
+          _state[2 * s] = z1;
+          _state[2 * s + 1] = z2;
+        }
+
+        for(size_t i = 0; i < nElements; ++i) _buffer[i] = detail::filterResultToUserType<UserType>(_samples[i]);
+
+        // hand over the filtered buffer to the output without copying
+        output.swap(_buffer);
+        output.write();
+
+        // wait for new input value (at the end, since we want to process the initial values first)
+        input.read();
+      }
+    }
+
+   protected:
+    /** Filter state, two values per section */
+    std::vector<double> _state;
+
+    /** Coefficients used for the current state */
+    std::vector<double> _lastCoefficients;
+
+    /** Samples in double precision while passing through the sections */
+    std::vector<double> _samples;
+
+    /** Buffer swapped with the input and output buffers */
+    std::vector<UserType> _buffer;
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
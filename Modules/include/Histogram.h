@@ -0,0 +1,222 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "ApplicationModule.h"
+#include "ArrayAccessor.h"
+#include "ScalarAccessor.h"
+#include "VariableGroup.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Module accumulating the values of a scalar or array input into a histogram.
+   *
+   * Each sample is sorted into one of nBins bins between config/lowerLimit and config/upperLimit. The bins are either
+   * equally spaced (config/logarithmic == 0) or equally spaced on a logarithmic scale (config/logarithmic != 0, both
+   * limits must be positive then). The bin index is computed directly from the value, so the cost per sample is
+   * constant and independent of the number of bins and of the history. For array inputs, the bin indices of all
+   * elements are computed in a separate tight loop before they are accumulated, which allows the compiler to vectorise
+   * the index computation.
+   *
+   * The accumulation mode is selected through the configuration:
+   *  - config/windowLength > 0: Windowed mode. Only the last windowLength samples are contained in the histogram.
+   *  - otherwise config/decayFactor < 1: Decaying mode. With each input update, the previous content of the histogram
+   *    is multiplied by decayFactor, i.e. older updates fade out exponentially.
+   *  - otherwise: All samples are accumulated without limit.
+   *
+   * The histogram is published with each update of the trigger input, which is typically connected to the tick of a
+   * PeriodicTrigger. Hence the histogram is published periodically, independent of the update rate of the input, also
+   * while the input is quiet. The trigger must be connected, otherwise the histogram is only published once at start.
+   * Changing the limits, the scale or the window length resets the histogram. As long as config/reset is non-zero,
+   * the histogram is cleared with each update of the input or the trigger.
+   *
+   * The input is an ArrayPushInput and hence can be connected to scalar feeders as well, if nElements is 1.
+   */
+  template<typename UserType>
+  struct Histogram : public ApplicationModule {
+    Histogram(EntityOwner* owner, const std::string& name, const std::string& description, size_t nElements,
+        size_t nBins, HierarchyModifier hierarchyModifier = HierarchyModifier::none,
+        const std::unordered_set<std::string>& tags = {})
+    : ApplicationModule(owner, name, description, hierarchyModifier, tags),
+      input(this, "input", "", nElements, "Input values to be accumulated into the histogram"),
+      histogram(this, "histogram", "", nBins, "Content of the histogram bins"),
+      binCentres(this, "binCentres", "", nBins, "Centre values of the histogram bins"), _nBins(nBins) {}
+
+    Histogram() = default;
+
+    ArrayPushInput<UserType> input;
+    ScalarPushInput<uint64_t> trigger{this, "trigger", "", "Publish the histogram with each update"};
+
+    struct Config : VariableGroup {
+      using VariableGroup::VariableGroup;
+      ScalarPollInput<double> lowerLimit{this, "lowerLimit", "", "Lower edge of the first bin"};
+      ScalarPollInput<double> upperLimit{this, "upperLimit", "", "Upper edge of the last bin"};
+      ScalarPollInput<int32_t> logarithmic{this, "logarithmic", "", "Use logarithmic bins if non-zero"};
+      ScalarPollInput<uint32_t> windowLength{
+          this, "windowLength", "", "Number of samples in the histogram. 0 disables the windowed mode."};
+      ScalarPollInput<double> decayFactor{this, "decayFactor", "",
+          "Factor applied to the histogram content per input update if not in windowed mode. Values outside (0,1) "
+          "disable the decay."};
+      ScalarPollInput<int32_t> reset{this, "reset", "", "Clear the histogram if non-zero"};
+    } config{this, "config", "Configuration of the histogram"};
+
+    ArrayOutput<double> histogram;
+    ArrayOutput<double> binCentres;
+    ScalarOutput<double> underflow{this, "underflow", "", "Number of samples below the lower limit"};
+    ScalarOutput<double> overflow{this, "overflow", "", "Number of samples above the upper limit"};
+    ScalarOutput<double> nEntries{this, "nEntries", "", "Total number of samples in the histogram"};
+
+    void mainLoop() override {
+      _indices.resize(input.getNElements());
+      auto group = readAnyGroup();
+
+      // initial values are accumulated, and the histogram is published right away
+      updateConfiguration();
+      accumulate();
+      publishHistogram();
+
+      while(true) {
+        auto id = group.readAny();
+        updateConfiguration();
+        if(id == input.getId()) {
+          accumulate();
+        }
+        else {
+          publishHistogram();
+        }
+      }
+    }
+
+   protected:
+    /** Index used for samples below the lower limit (also for non-positive samples in logarithmic mode) */
+    static constexpr int32_t underflowIndex = -1;
+
+    /** Read the configuration and reset the histogram if necessary. Returns true if the histogram has been reset. */
+    bool updateConfiguration() {
+      config.readAll();
+      double lower = config.lowerLimit;
+      double upper = config.upperLimit;
+      bool logarithmic = config.logarithmic != 0;
+      size_t windowLength = config.windowLength;
+
+      bool changed = !_configured || lower != _lowerLimit || upper != _upperLimit || logarithmic != _logarithmic ||
+          windowLength != _window.size() || config.reset != 0;
+      if(!changed) return false;
+      _configured = true;
+      _lowerLimit = lower;
+      _upperLimit = upper;
+      _logarithmic = logarithmic;
+
+      _offset = _logarithmic ? std::log(lower) : lower;
+      double range = (_logarithmic ? std::log(upper) : upper) - _offset;
+      // invalid ranges (including non-positive limits in logarithmic mode) put everything into the under/overflow
+      _scale = (range > 0) ? double(_nBins) / range : std::numeric_limits<double>::infinity();
+
+      for(size_t i = 0; i < _nBins; ++i) {
+        double centre = _offset + (double(i) + 0.5) * range / double(_nBins);
+        binCentres[i] = _logarithmic ? std::exp(centre) : centre;
+      }
+      binCentres.write();
+
+      _bins.assign(_nBins + 2, 0.);
+      _weight = 1.;
+      _window.assign(windowLength, 0);
+      _windowPosition = 0;
+      _windowFill = 0;
+      return true;
+    }
+
+    /** Add the current input values to the histogram */
+    void accumulate() {
+      // first compute all bin indices in a tight loop without dependencies between iterations
+      const double offset = _offset;
+      const double scale = _scale;
+      const double maxIndex = double(_nBins);
+      for(size_t i = 0; i < _indices.size(); ++i) {
+        double x = double(input[i]);
+        if(_logarithmic) x = (x > 0) ? std::log(x) : -std::numeric_limits<double>::infinity();
+        double position = (x - offset) * scale;
+        // NaN is counted as overflow
+        position = !(position < maxIndex) ? maxIndex : (position < 0 ? -1. : position);
+        _indices[i] = (position < 0) ? underflowIndex : int32_t(position);
+      }
+
+      if(!_window.empty()) {
+        // windowed mode: remove the samples leaving the window
+        for(auto index : _indices) {
+          if(_windowFill == _window.size()) {
+            _bins[_window[_windowPosition] + 1] -= 1.;
+          }
+          else {
+            ++_windowFill;
+          }
+          _window[_windowPosition] = index;
+          _windowPosition = (_windowPosition + 1) % _window.size();
+          _bins[index + 1] += 1.;
+        }
+        return;
+      }
+
+      // Decaying mode: instead of scaling all bins with each update, the weight of new samples is increased. The
+      // weight is divided out when publishing, and the bins are renormalised before the weight gets too large.
+      double decay = config.decayFactor;
+      if(decay > 0. && decay < 1.) {
+        _weight /= decay;
+        if(_weight > 1e100) {
+          for(auto& bin : _bins) bin /= _weight;
+          _weight = 1.;
+        }
+      }
+      for(auto index : _indices) _bins[index + 1] += _weight;
+    }
+
+    /** Write the histogram outputs */
+    void publishHistogram() {
+      double total = 0.;
+      for(size_t i = 0; i < _nBins; ++i) {
+        histogram[i] = _bins[i + 1] / _weight;
+        total += histogram[i];
+      }
+      underflow = _bins.front() / _weight;
+      overflow = _bins.back() / _weight;
+      nEntries = total + underflow + overflow;
+      histogram.write();
+      underflow.write();
+      overflow.write();
+      nEntries.write();
+    }
+
+    size_t _nBins{0};
+
+    /** Bins including underflow (first element) and overflow (last element) */
+    std::vector<double> _bins;
+
+    /** Bin indices of the current input values */
+    std::vector<int32_t> _indices;
+
+    /** Ring buffer with the bin indices of the samples inside the window (windowed mode only) */
+    std::vector<int32_t> _window;
+    size_t _windowPosition{0};
+    size_t _windowFill{0};
+
+    /** Weight of new samples (decaying mode only) */
+    double _weight{1.};
+
+    bool _configured{false};
+    double _lowerLimit{0.};
+    double _upperLimit{0.};
+    bool _logarithmic{false};
+    double _offset{0.};
+    double _scale{0.};
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
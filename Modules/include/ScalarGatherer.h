@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "ApplicationModule.h"
+#include "ArrayAccessor.h"
+#include "ScalarAccessor.h"
+#include "VariableGroup.h"
+
+#include <boost/chrono.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <chrono>
+#include <map>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  /**
+   * The ScalarGatherer collects many scalar process variables into a single array output, to reduce the number of
+   * variables which need to be transported to and published by the control system.
+   *
+   * On construction, it searches from its owner downwards for all scalar outputs carrying the given tag, and connects
+   * each of them to an internal ScalarPushInput. The names of the gathered variables are published once in the "names"
+   * output, in the same order as the elements of the "values" output.
+   *
+   * Whenever any of the inputs is updated, the "values" output is published together with the "changed" mask, which
+   * is 1 for all elements that have been updated since the previous publication and 0 otherwise. The publication rate
+   * is limited by minPeriod: if updates arrive faster, they are collected and published together once the
+   * period has elapsed. Since the module waits for the period to elapse in its own thread, a minPeriod of 0 should be
+   * used in testable mode.
+   *
+   * Note: The gathered variables are collected on construction. Hence, the ScalarGatherer has to be declared after all
+   * modules whose variables shall be gathered.
+   */
+  template<typename UserType>
+  struct ScalarGatherer : ApplicationModule {
+    /**
+     * Construct ScalarGatherer object. All scalar outputs below the owner which have the tag tagToGather are gathered.
+     * Throws a ChimeraTK::logic_error if no matching output has been found.
+     */
+    ScalarGatherer(EntityOwner* owner, const std::string& name, const std::string& description,
+        const std::string& tagToGather, HierarchyModifier hierarchyModifier = HierarchyModifier::none,
+        const std::unordered_set<std::string>& tags = {});
+
+    ScalarGatherer() = default;
+
+    ScalarPollInput<uint32_t> minPeriod{
+        this, "minPeriod", "ms", "Minimum time between two publications of the gathered values"};
+
+    ArrayOutput<UserType> values;
+    ArrayOutput<int32_t> changed;
+    ArrayOutput<std::string> names;
+
+    void mainLoop() override;
+
+   protected:
+    /** Reserved tag which is used to mark the internal inputs, so they are not gathered by other ScalarGatherers. */
+    constexpr static auto tagInternalVars = "_ChimeraTK_ScalarGatherer_internalVars";
+
+    struct Inputs : VariableGroup {
+      using VariableGroup::VariableGroup;
+      std::vector<ScalarPushInput<UserType>> inputs;
+    } _inputs;
+
+    /** Copy the value of the given input into the output buffer and mark it as changed */
+    void takeValue(size_t index) {
+      values[index] = _inputs.inputs[index];
+      changed[index] = 1;
+    }
+  };
+
+  /********************************************************************************************************************/
+  /********************************************************************************************************************/
+
+  template<typename UserType>
+  ScalarGatherer<UserType>::ScalarGatherer(EntityOwner* owner, const std::string& name,
+      const std::string& description, const std::string& tagToGather, HierarchyModifier hierarchyModifier,
+      const std::unordered_set<std::string>& tags)
+  : ApplicationModule(owner, name, description, hierarchyModifier, tags),
+    _inputs(this, "inputs", "Internal inputs of the ScalarGatherer", HierarchyModifier::none, {tagInternalVars}) {
+    // collect matching scalar outputs first, so the vector of inputs does not need to grow while creating them
+    std::vector<VariableNetworkNode> nodes;
+    for(auto& node : getOwner()->getAccessorListRecursive()) {
+      if(node.getDirection().dir != VariableDirection::feeding || node.getNumberOfElements() != 1) continue;
+      const auto& nodeTags = node.getTags();
+      if(nodeTags.count(tagToGather) == 0 || nodeTags.count(tagInternalVars) != 0) continue;
+      nodes.push_back(node);
+    }
+    if(nodes.empty()) {
+      throw ChimeraTK::logic_error("ScalarGatherer " + getQualifiedName() + " has not found any scalar output with tag '" +
+          tagToGather + "' to gather.");
+    }
+
+    _inputs.inputs.reserve(nodes.size());
+    for(size_t i = 0; i < nodes.size(); ++i) {
+      _inputs.inputs.emplace_back(&_inputs, "input" + std::to_string(i), "", nodes[i].getQualifiedName());
+      nodes[i] >> _inputs.inputs.back();
+    }
+
+    values = ArrayOutput<UserType>(this, "values", "", nodes.size(), "Values of the gathered variables");
+    changed = ArrayOutput<int32_t>(
+        this, "changed", "", nodes.size(), "1 for each value updated since the previous publication, 0 otherwise");
+    names = ArrayOutput<std::string>(this, "names", "", nodes.size(), "Qualified names of the gathered variables");
+    for(size_t i = 0; i < nodes.size(); ++i) names[i] = nodes[i].getQualifiedName();
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename UserType>
+  void ScalarGatherer<UserType>::mainLoop() {
+    std::map<TransferElementID, size_t> indexMap;
+    for(size_t i = 0; i < _inputs.inputs.size(); ++i) indexMap[_inputs.inputs[i].getId()] = i;
+
+    // publish the initial values
+    for(size_t i = 0; i < _inputs.inputs.size(); ++i) takeValue(i);
+    names.write();
+    values.write();
+    changed.write();
+    auto lastPublication = std::chrono::steady_clock::now();
+
+    auto group = readAnyGroup();
+    while(true) {
+      std::fill(changed.begin(), changed.end(), 0);
+      takeValue(indexMap.at(group.readAny()));
+
+      // If the previous publication is too recent, wait until the period has elapsed and collect all updates which
+      // arrived in the meantime. The boost sleep is an interruption point, so the module can be terminated meanwhile.
+      minPeriod.read();
+      auto nextPublication = lastPublication + std::chrono::milliseconds(uint32_t(minPeriod));
+      auto remaining = nextPublication - std::chrono::steady_clock::now();
+      if(remaining.count() > 0) {
+        boost::this_thread::sleep_for(
+            boost::chrono::nanoseconds(std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count()));
+      }
+      for(auto id = group.readAnyNonBlocking(); id.isValid(); id = group.readAnyNonBlocking()) {
+        takeValue(indexMap.at(id));
+      }
+
+      values.write();
+      changed.write();
+      lastPublication = std::chrono::steady_clock::now();
+    }
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
@@ -17,7 +17,15 @@ namespace ChimeraTK {
    *
    * The output is published to the CS line by line, each time adding to the string. This is not
    * super efficient, but allows to monitor the script while running and see intermediate output
-   * in case it gets stuck.
+   * in case it gets stuck. For scripts producing a lot of output, the publication can be throttled
+   * with the outputPublicationPeriod constructor parameter. Lines arriving within the period are then
+   * collected and published together.
+   *
+   * The output of the script is read in a separate thread, so the script can be supervised while it
+   * is running. If a timeout is given, the script (including all processes it has started) is killed
+   * when it has not finished in time, and the initialisation is treated as failed. The script is also
+   * killed when the application shuts down while the script is still running. The duration of the
+   * last script run is published in /Devices/ALIAS_OR_URI/OUTPUT_NAME + "Duration" (in seconds).
    *
    * The content is also printed to stdout, but only after the script has ended.
    * If the script has failed, only the output of the first run is printed to avoid
@@ -44,10 +52,14 @@ namespace ChimeraTK {
      * @param outputName Name of the PV with the output string. Defauls to "initScriptOutput", but can be changed in
      * case more than one script is needed for the device.
      * @param errorGracePeriod Additional time in seconds before a retry after an error.
+     * @param timeout Maximum run time of the script in seconds. The script is killed and the initialisation fails
+     * if it takes longer. 0 (default) means no timeout.
+     * @param outputPublicationPeriod Minimum time in milliseconds between two publications of the intermediate
+     * script output. 0 (default) publishes each line.
      */
     ScriptedInitHandler(EntityOwner* owner, const std::string& name, const std::string& description,
         const std::string& command, DeviceModule& deviceModule, const std::string& outputName = "initScriptOutput",
-        unsigned int errorGracePeriod = 10);
+        unsigned int errorGracePeriod = 10, unsigned int timeout = 0, unsigned int outputPublicationPeriod = 0);
     void mainLoop() override {
     } // no main loop needed. doInit() is called from the DeviceModule thread as initialisation handler
     void doInit();
@@ -57,10 +69,17 @@ namespace ChimeraTK {
     std::string _command;
     std::string _deviceAlias;
     std::string _outputName;
-    unsigned int _errorGracePeriod; // additional sleep time before a retry after an error
+    unsigned int _errorGracePeriod;        // additional sleep time before a retry after an error
+    unsigned int _timeout;                 // maximum run time of the script in seconds, 0 = no timeout
+    unsigned int _outputPublicationPeriod; // minimum time between two publications of the output in ms
     //_scriptOutput must be in this file after _outputName so the latter can be used as constructor parameter
     ModifyHierarchy<ScalarOutput<std::string>> _scriptOutput{
         this, RegisterPath("/Devices") / _deviceAlias / _outputName, "", "stdout+stderr of init script"};
+    ModifyHierarchy<ScalarOutput<double>> _scriptDuration{this,
+        RegisterPath("/Devices") / _deviceAlias / (_outputName + "Duration"), "s", "run time of the last init script"};
+
+    /** Publish the given (accumulated) script output. */
+    void publishOutput(const std::string& output);
   };
 
 } // namespace ChimeraTK
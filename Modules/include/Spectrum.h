@@ -0,0 +1,291 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "ApplicationModule.h"
+#include "ArrayAccessor.h"
+#include "ScalarAccessor.h"
+#include "VariableGroup.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Precomputed plan for a forward discrete Fourier transform of a fixed length.
+   *
+   * Power-of-two lengths are computed with an iterative radix-2 algorithm. All other lengths are mapped onto a
+   * power-of-two transform of at least twice the length with Bluestein's algorithm, so every length is computed in
+   * O(n log n). All twiddle factors, the bit-reversal permutation and the Bluestein chirp are computed once when the
+   * plan is created.
+   *
+   * Plans are immutable after construction and can be shared between threads. Use FFTPlan::get() to obtain a plan
+   * from the process-wide cache instead of constructing a new plan for each transform.
+   */
+  class FFTPlan {
+   public:
+    using Complex = std::complex<double>;
+
+    explicit FFTPlan(size_t n);
+
+    /** Obtain the plan for the given length from the cache. The plan is created on first use. */
+    static std::shared_ptr<const FFTPlan> get(size_t n);
+
+    /** Length of the transform */
+    size_t size() const { return _n; }
+
+    /**
+     * Compute the forward transform X[k] = sum_j x[j] exp(-2 pi i j k / n) in place. The size of data must match the
+     * plan size. The workspace is only used for non-power-of-two lengths. It is resized as needed and should be
+     * re-used between calls to avoid memory allocations.
+     */
+    void transform(std::vector<Complex>& data, std::vector<Complex>& workspace) const;
+
+   private:
+    /** In-place radix-2 transform for power-of-two lengths */
+    void radix2(Complex* data) const;
+
+    size_t _n;
+    bool _isPowerOfTwo;
+
+    /** Twiddle factors exp(-2 pi i k / n) for k < n/2 (power-of-two lengths only) */
+    std::vector<Complex> _twiddles;
+
+    /** Bit-reversal permutation as a list of index pairs to swap (power-of-two lengths only) */
+    std::vector<std::pair<uint32_t, uint32_t>> _swaps;
+
+    /** Chirp exp(-pi i k^2 / n) (Bluestein only) */
+    std::vector<Complex> _chirp;
+
+    /** Transformed convolution kernel, scaled by 1/m (Bluestein only) */
+    std::vector<Complex> _kernel;
+
+    /** Power-of-two plan used for the convolution (Bluestein only) */
+    std::shared_ptr<const FFTPlan> _convolutionPlan;
+  };
+
+  /********************************************************************************************************************/
+
+  /**
+   * Module computing the one-sided amplitude and phase spectrum of an array input.
+   *
+   * The input is multiplied with the window function selected by config/window (0 = rectangular, 1 = Hann,
+   * 2 = Hamming, 3 = Blackman) before the transform. The amplitude is normalised such that a sine with amplitude A
+   * results in a peak of height A (for frequencies falling exactly into one bin).
+   *
+   * If config/nAverages is larger than 1, the power spectrum is averaged exponentially with a time constant of
+   * nAverages updates before the amplitude is computed. The phase is always the phase of the latest update. Changing
+   * the window or the number of averages restarts the averaging.
+   *
+   * The output arrays have nElements / 2 + 1 elements, ranging from DC to the Nyquist frequency.
+   */
+  template<typename UserType>
+  struct Spectrum : public ApplicationModule {
+    Spectrum(EntityOwner* owner, const std::string& name, const std::string& description, size_t nElements,
+        HierarchyModifier hierarchyModifier = HierarchyModifier::none,
+        const std::unordered_set<std::string>& tags = {})
+    : ApplicationModule(owner, name, description, hierarchyModifier, tags),
+      input(this, "input", "", nElements, "Input waveform"),
+      amplitude(this, "amplitude", "", nElements / 2 + 1, "Amplitude spectrum from DC to the Nyquist frequency"),
+      phase(this, "phase", "rad", nElements / 2 + 1, "Phase spectrum from DC to the Nyquist frequency") {}
+
+    Spectrum() = default;
+
+    ArrayPushInput<UserType> input;
+
+    struct Config : VariableGroup {
+      using VariableGroup::VariableGroup;
+      ScalarPollInput<int32_t> window{
+          this, "window", "", "Window function: 0 = rectangular, 1 = Hann, 2 = Hamming, 3 = Blackman"};
+      ScalarPollInput<uint32_t> nAverages{this, "nAverages", "", "Time constant of the averaging in updates"};
+    } config{this, "config", "Configuration of the spectrum"};
+
+    ArrayOutput<double> amplitude;
+    ArrayOutput<double> phase;
+
+    void mainLoop() override {
+      const size_t n = input.getNElements();
+      _plan = FFTPlan::get(n);
+      _data.resize(n);
+      _power.assign(amplitude.getNElements(), 0.);
+
+      while(true) {
+        int32_t windowType = config.window;
+        uint32_t nAverages = config.nAverages;
+        config.readAll();
+        if(_window.empty() || windowType != config.window) computeWindow();
+        if(_window.empty() || windowType != config.window || nAverages != config.nAverages) _nAveraged = 0;
+
+        for(size_t i = 0; i < n; ++i) _data[i] = double(input[i]) * _window[i];
+        _plan->transform(_data, _workspace);
+
+        // average the power with a weight of 1/nAveraged for the first updates, so the average starts immediately
+        if(_nAveraged < std::max(uint32_t(config.nAverages), uint32_t(1))) ++_nAveraged;
+        const double weight = 1. / _nAveraged;
+        for(size_t k = 0; k < _power.size(); ++k) {
+          // all bins except DC and Nyquist receive the contribution of the negative frequency as well
+          double scale = (k == 0 || 2 * k == n) ? _normalisation : 2 * _normalisation;
+          double power = std::norm(_data[k]) * scale * scale;
+          _power[k] += (power - _power[k]) * weight;
+          amplitude[k] = std::sqrt(_power[k]);
+          phase[k] = std::arg(_data[k]);
+        }
+        amplitude.write();
+        phase.write();
+
+        // wait for new input value (at the end, since we want to process the initial values first)
+        input.read();
+      }
+    }
+
+   protected:
+    void computeWindow() {
+      const size_t n = input.getNElements();
+      _window.resize(n);
+      double sum = 0.;
+      for(size_t i = 0; i < n; ++i) {
+        double x = 2. * M_PI * double(i) / double(n);
+        switch(int32_t(config.window)) {
+          case 1:
+            _window[i] = 0.5 - 0.5 * std::cos(x);
+            break;
+          case 2:
+            _window[i] = 0.54 - 0.46 * std::cos(x);
+            break;
+          case 3:
+            _window[i] = 0.42 - 0.5 * std::cos(x) + 0.08 * std::cos(2. * x);
+            break;
+          default:
+            _window[i] = 1.;
+        }
+        sum += _window[i];
+      }
+      _normalisation = (sum > 0.) ? 1. / sum : 0.;
+    }
+
+    std::shared_ptr<const FFTPlan> _plan;
+    std::vector<FFTPlan::Complex> _data;
+    std::vector<FFTPlan::Complex> _workspace;
+    std::vector<double> _window;
+    double _normalisation{1.};
+    std::vector<double> _power;
+    uint32_t _nAveraged{0};
+  };
+
+  /********************************************************************************************************************/
+  /********************************************************************************************************************/
+
+  inline FFTPlan::FFTPlan(size_t n) : _n(n), _isPowerOfTwo((n & (n - 1)) == 0) {
+    if(_n < 2) return;
+
+    if(_isPowerOfTwo) {
+      _twiddles.resize(_n / 2);
+      for(size_t k = 0; k < _n / 2; ++k) {
+        _twiddles[k] = std::polar(1., -2. * M_PI * double(k) / double(_n));
+      }
+      size_t bits = 0;
+      while((size_t(1) << bits) < _n) ++bits;
+      for(size_t i = 0; i < _n; ++i) {
+        size_t reversed = 0;
+        for(size_t b = 0; b < bits; ++b) reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        if(reversed > i) _swaps.emplace_back(i, reversed);
+      }
+      return;
+    }
+
+    // Bluestein: express the transform as a convolution with the chirp, computed by a power-of-two transform
+    size_t m = 1;
+    while(m < 2 * _n - 1) m <<= 1;
+    _convolutionPlan = get(m);
+
+    _chirp.resize(_n);
+    for(size_t k = 0; k < _n; ++k) {
+      // reduce k^2 modulo 2n before converting to floating point, to keep the phase accurate for large k
+      uint64_t k2 = (uint64_t(k) * uint64_t(k)) % (2 * uint64_t(_n));
+      _chirp[k] = std::polar(1., -M_PI * double(k2) / double(_n));
+    }
+
+    _kernel.assign(m, 0.);
+    _kernel[0] = std::conj(_chirp[0]);
+    for(size_t k = 1; k < _n; ++k) {
+      _kernel[k] = _kernel[m - k] = std::conj(_chirp[k]);
+    }
+    _convolutionPlan->radix2(_kernel.data());
+    // include the normalisation of the inverse transform
+    for(auto& v : _kernel) v /= double(m);
+  }
+
+  /********************************************************************************************************************/
+
+  inline std::shared_ptr<const FFTPlan> FFTPlan::get(size_t n) {
+    static std::mutex mutex;
+    static std::map<size_t, std::shared_ptr<const FFTPlan>> cache;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = cache.find(n);
+      if(it != cache.end()) return it->second;
+    }
+
+    // Create the plan without holding the lock, since the Bluestein plans recursively obtain a power-of-two plan.
+    // If another thread creates the same plan concurrently, the first one ends up in the cache.
+    auto plan = std::make_shared<const FFTPlan>(n);
+    std::lock_guard<std::mutex> lock(mutex);
+    return cache.emplace(n, plan).first->second;
+  }
+
+  /********************************************************************************************************************/
+
+  inline void FFTPlan::transform(std::vector<Complex>& data, std::vector<Complex>& workspace) const {
+    assert(data.size() == _n);
+    if(_n < 2) return;
+
+    if(_isPowerOfTwo) {
+      radix2(data.data());
+      return;
+    }
+
+    const size_t m = _convolutionPlan->size();
+    workspace.resize(m);
+    for(size_t k = 0; k < _n; ++k) workspace[k] = data[k] * _chirp[k];
+    std::fill(workspace.begin() + long(_n), workspace.end(), 0.);
+
+    _convolutionPlan->radix2(workspace.data());
+    // inverse transform via the conjugated forward transform
+    for(size_t k = 0; k < m; ++k) workspace[k] = std::conj(workspace[k] * _kernel[k]);
+    _convolutionPlan->radix2(workspace.data());
+
+    for(size_t k = 0; k < _n; ++k) data[k] = std::conj(workspace[k]) * _chirp[k];
+  }
+
+  /********************************************************************************************************************/
+
+  inline void FFTPlan::radix2(Complex* data) const {
+    for(const auto& s : _swaps) std::swap(data[s.first], data[s.second]);
+
+    for(size_t length = 2; length <= _n; length <<= 1) {
+      const size_t half = length / 2;
+      const size_t stride = _n / length;
+      for(size_t start = 0; start < _n; start += length) {
+        for(size_t j = 0; j < half; ++j) {
+          Complex v = data[start + j + half] * _twiddles[j * stride];
+          data[start + j + half] = data[start + j] - v;
+          data[start + j] += v;
+        }
+      }
+    }
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
@@ -115,6 +115,9 @@ namespace ChimeraTK {
     /// Allow runtime debugging (FIXME: use Void instead!)
     ModifyHierarchy<ScalarPushInput<int>> debug{
         this, "/Debug/statusAggregators", "", "Print debug info for all status aggregators once."};
+
+    /// Print the current values of all inputs, upon request through the debug variable
+    void printDebugInfo();
   };
 
   /********************************************************************************************************************/
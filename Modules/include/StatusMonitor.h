@@ -262,7 +262,7 @@ namespace ChimeraTK {
   template<typename T>
   void MaxMonitor<T>::mainLoop() {
     // If there is a change either in value monitored or in requiredValue, the status is re-evaluated
-    ReadAnyGroup group{watch.value, disable.value, warningThreshold.value, faultThreshold.value};
+    CoalescingReadAnyGroup group{watch.value, disable.value, warningThreshold.value, faultThreshold.value};
 
     while(true) {
       if(disable.value) {
@@ -306,7 +306,7 @@ namespace ChimeraTK {
   template<typename T>
   void MinMonitor<T>::mainLoop() {
     // If there is a change either in value monitored or in requiredValue, the status is re-evaluated
-    ReadAnyGroup group{watch.value, disable.value, warningThreshold.value, faultThreshold.value};
+    CoalescingReadAnyGroup group{watch.value, disable.value, warningThreshold.value, faultThreshold.value};
 
     while(true) {
       if(disable.value) {
@@ -355,7 +355,7 @@ namespace ChimeraTK {
   template<typename T>
   void RangeMonitor<T>::mainLoop() {
     // If there is a change either in value monitored or in requiredValue, the status is re-evaluated
-    ReadAnyGroup group{watch.value, disable.value, warningLowerThreshold.value, warningUpperThreshold.value,
+    CoalescingReadAnyGroup group{watch.value, disable.value, warningLowerThreshold.value, warningUpperThreshold.value,
         faultLowerThreshold.value, faultUpperThreshold.value};
 
     while(true) {
@@ -400,7 +400,7 @@ namespace ChimeraTK {
   template<typename T>
   void ExactMonitor<T>::mainLoop() {
     // If there is a change either in value monitored or in requiredValue, the status is re-evaluated
-    ReadAnyGroup group{watch.value, disable.value, requiredValue.value};
+    CoalescingReadAnyGroup group{watch.value, disable.value, requiredValue.value};
 
     while(true) {
       if(disable.value) {
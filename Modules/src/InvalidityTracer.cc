@@ -40,8 +40,8 @@ namespace ChimeraTK {
       // ignore non-application nodes
       if(node.getType() != NodeType::Application) return;
 
-      // ignore non-inputs
-      if(node.getDirection().dir != VariableDirection::consuming) return;
+      // ignore non-inputs and inputs fed by folded constants (which are always valid and not decorated)
+      if(node.getDirection().dir != VariableDirection::consuming || node.isFoldedConstant()) return;
 
       // get accessor and cast into right type (all application accessors must have the
       // MetaDataPropagatingRegisterDecorator).
@@ -5,8 +5,14 @@
 #include "DeviceModule.h"
 
 #include <boost/process.hpp>
+#include <boost/thread.hpp>
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <mutex>
+#include <thread>
 namespace bp = boost::process;
 
 namespace ChimeraTK {
@@ -15,50 +21,119 @@ namespace ChimeraTK {
 
   ScriptedInitHandler::ScriptedInitHandler(EntityOwner* owner, const std::string& name, const std::string& description,
       const std::string& command, DeviceModule& deviceModule, const std::string& outputName,
-      unsigned int errorGracePeriod)
+      unsigned int errorGracePeriod, unsigned int timeout, unsigned int outputPublicationPeriod)
   : ApplicationModule(owner, name, description), _command(command), _deviceAlias(deviceModule.getDeviceAliasOrURI()),
-    _outputName(outputName), _errorGracePeriod(errorGracePeriod) {
+    _outputName(outputName), _errorGracePeriod(errorGracePeriod), _timeout(timeout),
+    _outputPublicationPeriod(outputPublicationPeriod) {
     deviceModule.addInitialisationHandler(std::bind(&ScriptedInitHandler::doInit, this));
   }
+
+  /**********************************************************************************************************************/
+
+  void ScriptedInitHandler::publishOutput(const std::string& output) {
+    _scriptOutput.value = output;
+    _scriptOutput.value.write();
+  }
+
   /**********************************************************************************************************************/
 
   void ScriptedInitHandler::doInit() {
     std::string output;
-    _scriptOutput.value = "";
-    _scriptOutput.value.write();
+    publishOutput(output);
+
+    auto startTime = std::chrono::steady_clock::now();
+    auto deadline = startTime + std::chrono::seconds(_timeout);
+    auto lastPublication = startTime;
+    bool timedOut = false;
+    int exitCode = 0;
 
     try {
       bp::ipstream out;
-      bp::child initScript(_command, (bp::std_out & bp::std_err) > out);
-      std::string line;
-      // Publish every line that is read from the script. It is appended to the output string
-      // such that a growing message is published.
-      // For debugging it is important to get the intermediate information. In case the script gets stuck
-      // you want to know what has already been printed.
-      while(initScript.running() && std::getline(out, line)) {
-        output += line + "\n";
-        _scriptOutput.value = output;
-        _scriptOutput.value.write();
-      }
-      initScript.wait();
-
-      if(initScript.exit_code() != 0) {
-        output += "!!! " + _deviceAlias + " initialisation FAILED!";
-        _scriptOutput.value = output;
-        _scriptOutput.value.write();
-        if(!_lastFailed) {
-          std::cerr << output << std::endl;
+      // The group contains all processes started by the script, so they can be killed together on timeout. Otherwise
+      // e.g. a "sleep" inside the script would keep the output pipe open after killing the script itself.
+      bp::group scriptGroup;
+      bp::child initScript(_command, (bp::std_out & bp::std_err) > out, scriptGroup);
+
+      // The output is read in a separate thread, so this thread can supervise the run time of the script and throttle
+      // the publication, and does not block in getline() when the script hangs.
+      std::mutex mutex;
+      std::condition_variable newLines;
+      std::deque<std::string> lines;
+      bool endOfOutput = false;
+      std::thread reader([&] {
+        std::string line;
+        while(std::getline(out, line)) {
+          std::lock_guard<std::mutex> lock(mutex);
+          lines.push_back(std::move(line));
+          newLines.notify_one();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        endOfOutput = true;
+        newLines.notify_one();
+      });
+
+      auto killScript = [&] {
+        std::error_code ec;
+        scriptGroup.terminate(ec);
+        reader.join();
+        initScript.wait(ec);
+      };
+
+      try {
+        bool scriptFinished = false;
+        bool unpublishedOutput = false;
+        while(!scriptFinished) {
+          // Wait in short slices to regularly check the timeout and whether the application is shutting down.
+          std::deque<std::string> receivedLines;
+          {
+            std::unique_lock<std::mutex> lock(mutex);
+            if(!endOfOutput) {
+              newLines.wait_for(lock, std::chrono::milliseconds(100), [&] { return !lines.empty() || endOfOutput; });
+            }
+            else {
+              // no further notifications will come, just poll for the termination of the script
+              newLines.wait_for(lock, std::chrono::milliseconds(10));
+            }
+            receivedLines.swap(lines);
+            // once the output has been closed, only the termination of the script itself is awaited
+            scriptFinished = endOfOutput && !initScript.running();
+          }
+
+          // Publish every line that is read from the script, or all lines received within the publication period
+          // together. It is appended to the output string such that a growing message is published.
+          // For debugging it is important to get the intermediate information. In case the script gets stuck
+          // you want to know what has already been printed.
+          for(auto& line : receivedLines) {
+            output += line + "\n";
+            if(_outputPublicationPeriod == 0) publishOutput(output);
+          }
+          auto now = std::chrono::steady_clock::now();
+          if(_outputPublicationPeriod != 0) {
+            unpublishedOutput |= !receivedLines.empty();
+            if(unpublishedOutput && now - lastPublication >= std::chrono::milliseconds(_outputPublicationPeriod)) {
+              publishOutput(output);
+              lastPublication = now;
+              unpublishedOutput = false;
+            }
+          }
+
+          if(!scriptFinished && _timeout != 0 && now >= deadline) {
+            timedOut = true;
+            killScript();
+            break;
+          }
+          boost::this_thread::interruption_point();
+        }
+        if(!timedOut) {
+          reader.join();
+          initScript.wait();
+          exitCode = initScript.exit_code();
         }
-        _lastFailed = true;
-        std::this_thread::sleep_for(std::chrono::seconds(_errorGracePeriod));
-        throw ChimeraTK::runtime_error(_deviceAlias + " initialisation failed.");
       }
-      else {
-        output += _deviceAlias + " initialisation SUCCESS!";
-        _scriptOutput.value = output;
-        _scriptOutput.value.write();
-        std::cerr << output << std::endl;
-        _lastFailed = false;
+      catch(...) {
+        // never leave the script or the reader thread running, e.g. when the application is shut down
+        if(reader.joinable()) killScript();
+        throw;
       }
     }
     catch(bp::process_error& e) {
@@ -66,6 +141,29 @@ namespace ChimeraTK {
       throw ChimeraTK::logic_error("Caught boost::process::process_error while executing \"" + _command +
           "\" for device " + _deviceAlias + ": " + e.what());
     }
+
+    _scriptDuration.value = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    _scriptDuration.value.write();
+
+    if(timedOut || exitCode != 0) {
+      if(timedOut) {
+        output += "!!! " + _deviceAlias + " initialisation script killed after timeout of " +
+            std::to_string(_timeout) + " seconds.\n";
+      }
+      output += "!!! " + _deviceAlias + " initialisation FAILED!";
+      publishOutput(output);
+      if(!_lastFailed) {
+        std::cerr << output << std::endl;
+      }
+      _lastFailed = true;
+      boost::this_thread::sleep_for(boost::chrono::seconds(_errorGracePeriod));
+      throw ChimeraTK::runtime_error(_deviceAlias + " initialisation failed.");
+    }
+
+    output += _deviceAlias + " initialisation SUCCESS!";
+    publishOutput(output);
+    std::cerr << output << std::endl;
+    _lastFailed = false;
   }
 
   /**********************************************************************************************************************/
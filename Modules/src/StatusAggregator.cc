@@ -169,7 +169,7 @@ namespace ChimeraTK {
       if(x.hasMessageSource) inputsMap[x._message.getId()] = &x;
     }
 
-    auto rag = readAnyGroup();
+    auto rag = coalescingReadAnyGroup();
     DataValidity lastStatusValidity = DataValidity::ok;
     while(true) {
       // find highest priority status of all inputs
@@ -222,37 +222,44 @@ namespace ChimeraTK {
         lastStatusValidity = getDataValidity();
       }
 
-      // wait for changed inputs
-    waitForChange:
-      auto change = rag.readAny();
-      auto f = inputsMap.find(change);
-      if(f != inputsMap.end()) {
-        auto varPair = f->second;
-        if(!varPair->update(change)) goto waitForChange; // inputs not in consistent state yet
-      }
-
-      // handle request for debug info
-      if(change == debug.value.getId()) {
-        static std::mutex debugMutex; // all aggregators trigger at the same time => lock for clean output
-        std::unique_lock<std::mutex> lk(debugMutex);
-
-        std::cout << "StatusAggregtor " << getQualifiedName() << " debug info:" << std::endl;
-        for(auto& inputPair : _inputs) {
-          StatusPushInput& input = inputPair._status;
-          std::cout << input.getName() << " = " << input;
-          if(inputPair.hasMessageSource) {
-            std::cout << inputPair._message.getName() << " = " << (std::string)inputPair._message;
+      // wait for changed inputs. Updates of several inputs with the same version number (e.g. caused by the same
+      // trigger) are processed at once, so the status is computed only once for them.
+      bool changed = false;
+      while(!changed) {
+        for(auto& change : rag.readAny()) {
+          // handle request for debug info
+          if(change == debug.value.getId()) {
+            printDebugInfo();
+            continue;
           }
-          std::cout << std::endl;
+          auto f = inputsMap.find(change);
+          // inputs with a message source might not be in a consistent state yet
+          changed |= f == inputsMap.end() || f->second->update(change);
         }
-        std::cout << "debug info finished." << std::endl;
-        goto waitForChange;
       }
     }
   }
 
   /********************************************************************************************************************/
 
+  void StatusAggregator::printDebugInfo() {
+    static std::mutex debugMutex; // all aggregators trigger at the same time => lock for clean output
+    std::unique_lock<std::mutex> lk(debugMutex);
+
+    std::cout << "StatusAggregtor " << getQualifiedName() << " debug info:" << std::endl;
+    for(auto& inputPair : _inputs) {
+      StatusPushInput& input = inputPair._status;
+      std::cout << input.getName() << " = " << input;
+      if(inputPair.hasMessageSource) {
+        std::cout << inputPair._message.getName() << " = " << (std::string)inputPair._message;
+      }
+      std::cout << std::endl;
+    }
+    std::cout << "debug info finished." << std::endl;
+  }
+
+  /********************************************************************************************************************/
+
   void StatusAggregator::findTagAndAppendToModule(VirtualModule& virtualParent, const std::string& tag,
       bool eliminateAllHierarchies, bool eliminateFirstHierarchy, bool negate, VirtualModule& root) const {
     // Change behaviour to exclude the auto-generated inputs which are connected to the data sources. Otherwise those
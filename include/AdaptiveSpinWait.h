@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <ChimeraTK/TransferElement.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  namespace detail {
+
+    /** Hint to the CPU that we are inside a spin-wait loop */
+    inline void spinPause() {
+#if defined(__x86_64__) || defined(__i386__)
+      __builtin_ia32_pause();
+#elif defined(__aarch64__)
+      asm volatile("yield");
+#endif
+    }
+
+  } // namespace detail
+
+  /********************************************************************************************************************/
+
+  /**
+   * Spin-then-block strategy for blocking reads, see ApplicationModule::setReadSpinTime().
+   *
+   * The typical inter-arrival time of the data and its jitter are learned from the arrival times (exponentially
+   * weighted moving averages). Before a blocking read, wait() spins on the read queue only if the next value is
+   * expected to arrive within the configured maximum spin time, and only until the expected arrival time plus twice
+   * the typical jitter. Hence a slowly or irregularly updated variable never spins, while a fast loop avoids the cost
+   * of putting the thread to sleep and waking it up again.
+   *
+   * Not thread safe, each instance must be used by a single thread only.
+   */
+  class AdaptiveSpinWait {
+   public:
+    explicit AdaptiveSpinWait(std::chrono::nanoseconds maxSpinTime) : _maxSpinTime(maxSpinTime) {}
+
+    /** Spin until the queue is no longer empty or the data is not expected to arrive any more within the spin
+     *  budget. Returns true if data is available in the queue, i.e. the following read will not block. */
+    bool wait(cppext::future_queue<void>& queue) {
+      return waitUntil([&] { return !queue.empty(); });
+    }
+
+    /** Like wait(), but for data which is not signalled through a single queue (e.g. a ReadAnyGroup). The predicate
+     *  is called repeatedly while spinning and must return true once the data is available. */
+    template<typename Predicate>
+    bool waitUntil(Predicate hasData);
+
+    /** Record the arrival of a new value, to learn the inter-arrival time. */
+    void arrived();
+
+    /** Learned inter-arrival time. Zero until at least two values have arrived. */
+    std::chrono::nanoseconds getTypicalInterval() const;
+
+    /** Number of times the data arrived while spinning */
+    uint64_t getSpinHits() const { return _spinHits; }
+
+    /** Number of times the spinning was in vain and the thread had to block */
+    uint64_t getSpinMisses() const { return _spinMisses; }
+
+   protected:
+    using Clock = std::chrono::steady_clock;
+
+    /** Compute the time until which to spin. Returns false if spinning is not worth it. */
+    bool getDeadline(Clock::time_point& deadline) const;
+
+    std::chrono::nanoseconds _maxSpinTime;
+
+    Clock::time_point _lastArrival;
+    uint64_t _nArrivals{0};
+
+    /** Moving averages of the inter-arrival time and of its absolute deviation, in nanoseconds */
+    double _meanInterval{0.};
+    double _meanDeviation{0.};
+
+    uint64_t _spinHits{0};
+    uint64_t _spinMisses{0};
+  };
+
+  /********************************************************************************************************************/
+
+  template<typename Predicate>
+  bool AdaptiveSpinWait::waitUntil(Predicate hasData) {
+    if(hasData()) return true;
+
+    Clock::time_point deadline;
+    if(!getDeadline(deadline)) return false;
+
+    do {
+      for(size_t i = 0; i < 16; ++i) detail::spinPause();
+      if(hasData()) {
+        ++_spinHits;
+        return true;
+      }
+    } while(Clock::now() < deadline);
+    ++_spinMisses;
+    return false;
+  }
+
+  /********************************************************************************************************************/
+
+} /* namespace ChimeraTK */
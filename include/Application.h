@@ -6,11 +6,20 @@
 #include "Flags.h"
 #include "InternalModule.h"
 #include "VariableNetwork.h"
+#include "VariableNetworkGraphStreamingVisitor.h"
 
 #include <ChimeraTK/ControlSystemAdapter/ApplicationBase.h>
 #include <ChimeraTK/DeviceBackend.h>
 
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
 #include <atomic>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <memory>
 #include <mutex>
 
 namespace ChimeraTK {
@@ -24,6 +33,12 @@ namespace ChimeraTK {
   class TestFacility;
   class DeviceModule;
   class ApplicationModule;
+  class IntrospectionServer;
+
+  namespace detail {
+    struct ThreadStatus;
+    struct TriggerStatistics;
+  }
 
   template<typename UserType>
   class Accessor;
@@ -66,6 +81,16 @@ namespace ChimeraTK {
      * published variables to an XML file. */
     void generateXML();
 
+    /** Instead of running the application, build and check the connection model without creating any
+     *  implementation, e.g. to validate the application and its configuration in a separate process. Throws a
+     *  ChimeraTK::logic_error if the connections are not valid. The application cannot be initialised afterwards. */
+    void validateConnections();
+
+    /** Return the number of application inputs fed by constants (including unconnected inputs), which have been
+     *  folded when making the connections: They have obtained their value once and take no part in any transfer,
+     *  e.g. in Module::readAll() or Module::readAnyGroup(). Folding is not applied in testable mode. */
+    size_t getNumberOfFoldedConstants() const { return nFoldedConstants; }
+
     /** Output the connections requested in the initialise() function to
      * std::cout. This may be done also before
      *  makeConnections() has been called. */
@@ -75,6 +100,10 @@ namespace ChimeraTK {
      * connections made in the initilise() function. @see dumpConnections */
     void dumpConnectionGraph(const std::string& filename = {"connections-graph.dot"});
 
+    /** Create Graphviz dot graph of the connections selected by the filter and write it to the stream. The graph is
+     *  written while visiting the networks, so this is suitable also for very large applications. */
+    void dumpConnectionGraph(std::ostream& stream, const ConnectionGraphFilter& filter) const;
+
     /** Create Graphviz dot graph representing the connections between the modules, and write to file.*/
     void dumpModuleConnectionGraph(const std::string& filename = {"module-connections-graph.dot"}) const;
 
@@ -163,8 +192,129 @@ namespace ChimeraTK {
      * debugging and to allow profiling. */
     static void registerThread(const std::string& name);
 
+    /** Start a thread executing the given function, using the stack configuration of setThreadStackSize(). A non-zero
+     *  stackSize overrides the application-wide stack size, see ApplicationModule::setThreadStackSize(). All threads
+     *  of the framework are started through this function. */
+    static boost::thread createThread(std::function<void()> function, size_t stackSize = 0);
+
+    /** Apply the scheduling policy of the given priority class to the calling thread, see
+     *  ApplicationModule::setPriority(). If the scheduling policy cannot be changed (e.g. due to missing permissions),
+     *  a warning is printed and the thread keeps its current policy. */
+    static void setThreadPriority(ModulePriority priority);
+
     void debugMakeConnections() { enableDebugMakeConnections = true; };
 
+    /** Enable the local introspection endpoint: when the application is running, a Unix domain socket is created at
+     *  the given path, which reports the state of the application threads, variables and devices to each connecting
+     *  client. See IntrospectionServer for details. The socket is not reachable through the network. If the socket
+     *  cannot be created, an error message is printed and the application runs without it.
+     *
+     *  This function must be called before the application is started, e.g. in the constructor. */
+    void enableIntrospectionSocket(const std::string& socketPath);
+
+    /** Enable caching of the resolved connection model in the given file. If the file exists and has been written by
+     *  the same executable (same size and modification time) for the same application class, model version and module
+     *  tree (same modules and accessors with identical properties), the networks are restored from it in
+     *  initialise(), and defineConnections() is not called at all. Otherwise the connections are resolved as usual and
+     *  the file is (re-)written. See ConnectionModelCache for details.
+     *
+     *  This is meant to speed up the startup of large applications in tests. The connections made in
+     *  defineConnections() are NOT part of the cache key, since evaluating them is exactly what the cache avoids.
+     *  Rebuilding the executable invalidates the cache, but anything else the connections depend on at run time
+     *  (configuration values, constructor arguments, environment variables etc.) does not. In this case, the
+     *  modelVersion must be changed whenever the connections change, otherwise a stale model with the wrong wiring is
+     *  restored silently. defineConnections() must not have any other side effects.
+     *
+     *  This function must be called before the application is initialised, e.g. in the constructor. */
+    void enableConnectionModelCache(const std::string& fileName, const std::string& modelVersion = {});
+
+    /** Avoid page faults and TLB misses in the application threads. When the application is started, after all modules
+     *  have been prepared and before any thread is launched, the memory of the process is locked into RAM with
+     *  mlockall(), which faults in all pages of the already allocated buffers. If useHugePages is true, large anonymous
+     *  memory regions (which contain the buffers of large arrays) are advised to be backed by transparent huge pages
+     *  before locking. After all threads have been started, the memory is locked on fault (MCL_ONFAULT), so pages
+     *  touched later (e.g. new allocations and the used parts of the thread stacks) stay resident, without faulting in
+     *  the unused parts of the thread stacks.
+     *
+     *  Locking the memory requires a sufficient RLIMIT_MEMLOCK (or CAP_IPC_LOCK). If it fails, a warning is printed
+     *  and the application runs without it. Memory locking is not applied in testable mode.
+     *
+     *  This function must be called before the application is started, e.g. in the constructor. */
+    void enableMemoryLocking(bool useHugePages = true);
+
+    /** Set the stack size for all threads started by the framework (module, fan out, device and internal threads),
+     *  instead of the system default (typically 8 MiB, see "ulimit -s"). Large applications with many threads can
+     *  reduce their virtual memory footprint this way, and their resident memory if the memory is locked (see
+     *  enableMemoryLocking()). The stack size of individual modules can be changed with
+     *  ApplicationModule::setThreadStackSize(). Each stack is protected by a guard area of guardSize bytes, so an
+     *  overflow results in a segmentation fault instead of silently corrupting other memory. The guard should be
+     *  larger than the biggest stack frame, since a frame can otherwise jump over the guard.
+     *
+     *  Use getThreadStackUsage() (or the introspection socket) to find out how much stack the threads actually use.
+     *
+     *  This function must be called before the application is started, e.g. in the constructor. */
+    void setThreadStackSize(size_t stackSize, size_t guardSize = 64 * 1024);
+
+    /** Return the stack size for threads started by the framework, 0 for the system default. See
+     *  setThreadStackSize(). */
+    size_t getThreadStackSize() const { return threadStackSize; }
+
+    /** Stack usage of a thread, see getThreadStackUsage() */
+    struct ThreadStackUsage {
+      std::string name;
+      size_t stackSize;
+      size_t highWaterMark;
+    };
+
+    /** Return the stack size and the high-water mark (the maximum number of bytes used so far) of the stacks of all
+     *  registered threads which are still running. The main thread is not included. The high-water mark is accurate
+     *  to the page, or better if the stack memory was already resident when the thread was started (e.g. due to
+     *  enableMemoryLocking()). See setThreadStackSize(). */
+    std::vector<ThreadStackUsage> getThreadStackUsage();
+
+    /** Propagate the initial values in the order of the data flow. When reading its initial values, each
+     *  ApplicationModule waits until the modules feeding its push-type inputs have written the corresponding outputs
+     *  after entering their mainLoop(), i.e. until they have completed their first iteration. Values which have been
+     *  superseded in the meantime (e.g. initial values written in prepare()) are skipped, so the first iteration of
+     *  each module sees the final startup values of all upstream modules, and deep module chains do not recompute
+     *  and republish once for each value trickling in.
+     *
+     *  Inputs in circular dependency networks are excluded. maxWait limits the total time each module waits for all of
+     *  its upstream modules, starting when it begins reading its push-type initial values. If an upstream module has
+     *  not written an output by then (e.g. because it only writes on changes), a warning is printed and the first
+     *  value is used as usual.
+     *
+     *  This function must be called before the application is started, e.g. in the constructor. */
+    void enableOrderedInitialValues(std::chrono::milliseconds maxWait = std::chrono::seconds(1));
+
+    /** Return the number of initial values which have been skipped because they were superseded during startup, see
+     *  enableOrderedInitialValues(). */
+    size_t getNumberOfSupersededInitialValues() const { return nSupersededInitialValues; }
+
+    /** Wake up modules waiting for initial values of upstream modules. Called by the
+     *  MetaDataPropagatingRegisterDecorator when an output has published its initial value, see
+     *  enableOrderedInitialValues(). */
+    void notifyInitialValuePublished();
+
+    /** Set the policy how the TriggerFanOut for the given trigger handles triggers which arrive while the device
+     *  variables are still being read for the previous trigger. The trigger must be the same node which is used as
+     *  external trigger in the connections, e.g. the tick output of a PeriodicTrigger.
+     *
+     *  If statisticsPath is not empty, the following variables are published to the control system in the
+     *  directory <statisticsPath>/<deviceAlias> for each device read with this trigger: cycleDuration (time between
+     *  receiving the trigger and distributing the data, in milliseconds), nOverruns (number of cycles after which the
+     *  next trigger had already arrived) and nSkippedTriggers (number of triggers discarded with
+     *  TriggerOverrunPolicy::skipStale). They are ordinary outputs of the DeviceModule in the connection model, so they
+     *  also appear e.g. in the XML file and the connection graph. The alias is used with slashes replaced by
+     *  underscores.
+     *
+     *  If the given node does not end up as external trigger of any TriggerFanOut (i.e. it does not trigger reading
+     *  any poll-type device register), initialise() throws a ChimeraTK::logic_error.
+     *
+     *  This function must be called before the application is initialised, e.g. in defineConnections(). */
+    void setTriggerOverrunPolicy(
+        const VariableNetworkNode& trigger, TriggerOverrunPolicy policy, const std::string& statisticsPath = "");
+
     ModuleType getModuleType() const override { return ModuleType::ModuleGroup; }
 
     std::string getQualifiedName() const override { return "/" + _name; }
@@ -251,6 +401,7 @@ namespace ChimeraTK {
     friend class VariableNetworkNode;
     friend class VariableNetworkGraphDumpingVisitor;
     friend class VariableNetworkModuleGraphDumpingVisitor;
+    friend class VariableNetworkGraphStreamingVisitor;
     friend class XMLGeneratorVisitor;
     friend class ConnectingDeviceModule;
     friend class StatusAggregator;
@@ -271,6 +422,12 @@ namespace ChimeraTK {
      * Device and ControlSystem variables */
     void finaliseNetworks();
 
+    /** Create the statistics variables requested with setTriggerOverrunPolicy() and connect them to the control system.
+     *  One detail::TriggerStatistics group is created in the DeviceModule for each device read by the TriggerFanOut of
+     *  a trigger with statistics, so they are part of the connection model like any other output. Called at the end of
+     *  finaliseNetworks(), since only then it is known which networks are read by a TriggerFanOut. */
+    void defineTriggerStatistics();
+
     /** Check if all connections are valid. Internally called in initialise(). */
     void checkConnections();
 
@@ -285,10 +442,19 @@ namespace ChimeraTK {
     /** Register the connections to constants for previously unconnected nodes. */
     void processUnconnectedNodes();
 
+    /** Call defineConnections() of the application and all modules, and complete the resulting model with constants
+     *  and unconnected nodes. This is the first part of initialise(), which is shared with generateXML() and
+     *  validateConnections(). */
+    void defineConnectionModel();
+
     /** Make the connections between accessors as requested in the initialise()
      * function. */
     void makeConnections();
 
+    /** Create the implementations for the finalised networks. This is the part of makeConnections() which is also
+     *  executed when the connection model has been restored from the cache. */
+    void realiseConnections();
+
     /** Apply optimisations to the VariableNetworks, e.g. by merging networks
      * sharing the same feeder. */
     void optimiseConnections();
@@ -296,18 +462,25 @@ namespace ChimeraTK {
     /** Make the connections for a single network */
     void makeConnectionsForNetwork(VariableNetwork& network);
 
-    /** Scan for circular dependencies and mark all affcted consuming nodes.
-     *  This can only be done after all connections have been established. */
-    void markCircularConsumers(VariableNetwork& variableNetwork);
+    /** Scan for circular dependencies and mark all affcted consuming nodes. The module-level dependency graph is
+     *  built once for all networks. This can only be done after all connections have been established. */
+    void markCircularConsumers();
 
     /** UserType-dependent part of makeConnectionsForNetwork() */
     template<typename UserType>
     void typedMakeConnection(VariableNetwork& network);
 
+    /** Check whether the given consumer of a constant can be folded, i.e. obtain the constant value already when
+     *  making the connections and no longer take part in any transfer. This is the case for application inputs outside
+     *  testable mode. Push-type inputs can only be folded if the owning module has other push-type inputs, since
+     *  otherwise Module::readAll() and readAny() would no longer block. */
+    bool isFoldableConstantConsumer(const VariableNetworkNode& consumer) const;
+
     /** Helper function to set consumer implementations in typedMakeConnection() */
     template<typename UserType>
     std::list<std::pair<boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>, VariableNetworkNode>>
-        setConsumerImplementations(VariableNetworkNode const& feeder, std::list<VariableNetworkNode> consumers);
+        setConsumerImplementations(
+            VariableNetworkNode const& feeder, const std::vector<VariableNetworkNode>& consumers);
 
     /** Functor class to call typedMakeConnection() with the right template
      * argument. */
@@ -353,10 +526,22 @@ namespace ChimeraTK {
     /** List of constant variable nodes */
     std::list<VariableNetworkNode> constantList;
 
+    /** Number of application inputs fed by folded constants, see isFoldableConstantConsumer() */
+    size_t nFoldedConstants{0};
+
     /** Map of trigger consumers to their corresponding TriggerFanOuts. Note: the
      * key is the ID (address) of the externalTiggerImpl. */
     std::map<const void*, boost::shared_ptr<TriggerFanOut>> triggerMap;
 
+    /** Overrun handling settings for triggers, see setTriggerOverrunPolicy(). The key is the trigger node. */
+    struct TriggerOverrunSettings {
+      TriggerOverrunPolicy policy;
+      std::string statisticsPath;
+      bool used{false}; // set when applied to a TriggerFanOut
+      std::map<std::string, detail::TriggerStatistics*> statistics; // by device alias, see defineTriggerStatistics()
+    };
+    std::map<VariableNetworkNode, TriggerOverrunSettings> triggerOverrunSettings;
+
     /** Map of control system type VariableNetworkNodes handed out by ControlSystemModules. This is used to hand out
      *  the same node again if the same variable is requested another time, to ensure the connections are registered in
      *  the same network. */
@@ -493,12 +678,63 @@ namespace ChimeraTK {
     /** Map of thread names */
     std::map<boost::thread::id, std::string> threadNames;
 
+    /** Status of all registered threads, reported by the IntrospectionServer. The status is owned by the thread (see
+     *  detail::currentThreadStatus), so entries of terminated threads expire and are pruned. Protected by
+     *  m_threadNames. */
+    std::list<std::weak_ptr<detail::ThreadStatus>> threadStatusList;
+
+    /** Return the status of all running registered threads and prune the entries of terminated threads */
+    std::list<std::shared_ptr<detail::ThreadStatus>> getThreadStatusList();
+
     std::mutex m_threadNames;
 
+    /** Path of the introspection socket, empty if disabled. See enableIntrospectionSocket(). */
+    std::string introspectionSocketPath;
+
+    /** The running introspection server, if enabled */
+    std::shared_ptr<IntrospectionServer> introspectionServer;
+
+    /** File name of the connection model cache, empty if disabled. See enableConnectionModelCache(). */
+    std::string connectionModelCacheFile;
+
+    /** User-supplied version of the connection model, part of the cache key. See enableConnectionModelCache(). */
+    std::string connectionModelVersion;
+
+    /** Flags whether the memory is locked and whether huge pages are used when starting. See enableMemoryLocking(). */
+    bool memoryLocking{false};
+    bool memoryLockingHugePages{false};
+
+    /** Lock the memory of the process before the threads are started, see enableMemoryLocking(). */
+    void lockMemory();
+
+    /** Lock the memory of the process on fault after the threads have been started, see enableMemoryLocking(). */
+    void lockMemoryOnFault();
+
+    /** Stack and guard size for threads started by the framework, 0 for the system default. See
+     *  setThreadStackSize(). */
+    size_t threadStackSize{0};
+    size_t threadStackGuardSize{0};
+
+    /** Maximum time to wait for initial values of upstream modules, zero if disabled. See
+     *  enableOrderedInitialValues(). */
+    std::chrono::milliseconds orderedInitialValuesMaxWait{0};
+    boost::mutex orderedInitialValuesMutex;
+    boost::condition_variable orderedInitialValuesCondition;
+    std::atomic<size_t> nSupersededInitialValues{0};
+
+    /** Wait until the feeder of the given push-type input has published its initial value, but not beyond the given
+     *  deadline, which is shared by all inputs of the module. Returns true if superseded values shall be skipped after
+     *  reading the initial value. See enableOrderedInitialValues(). */
+    bool waitForUpstreamInitialValue(
+        const VariableNetworkNode& consumer, boost::chrono::steady_clock::time_point deadline);
+
     template<typename UserType>
     friend class
         TestableModeAccessorDecorator; // needs access to the testableMode_mutex and testableMode_counter and the idMap
 
+    friend class IntrospectionServer; // needs access to networkList, deviceModuleMap and threadStatusList
+    friend class ConnectionModelCache; // needs access to networkList, controlSystemVariables and constantList
+
     friend class TestFacility;  // needs access to testableMode_variables
     friend class DeviceModule;  // needs access to testableMode_variables
     friend class TriggerFanOut; // needs access to testableMode_variables
@@ -531,10 +767,6 @@ namespace ChimeraTK {
       throw ChimeraTK::logic_error("decrementDataFaultCounter() called on the application. This is probably "
                                    "caused by incorrect ownership of variables/accessors or VariableGroups.");
     }
-    std::list<EntityOwner*> getInputModulesRecursively([[maybe_unused]] std::list<EntityOwner*> startList) override {
-      throw ChimeraTK::logic_error("getInputModulesRecursively() called on the application. This is probably "
-                                   "caused by incorrect ownership of variables/accessors or VariableGroups.");
-    }
     size_t getCircularNetworkHash() override {
       throw ChimeraTK::logic_error("getCircularNetworkHash() called on the application. This is probably "
                                    "caused by incorrect ownership of variables/accessors or VariableGroups.");
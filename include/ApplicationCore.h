@@ -7,7 +7,9 @@
 #include "ArrayAccessor.h"
 #include "ConfigReader.h"
 #include "ControlSystemModule.h"
+#include "CyclicExecutive.h"
 #include "DeviceModule.h"
+#include "FixedArrayAccessor.h"
 #include "HierarchyModifyingGroup.h"
 #include "ModuleGroup.h"
 #include "ScalarAccessor.h"
@@ -2,11 +2,11 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 #pragma once
 
-#include "CircularDependencyDetectionRecursionStopper.h"
 #include "ModuleImpl.h"
 
 #include <boost/thread.hpp>
 
+#include <chrono>
 #include <list>
 
 namespace ChimeraTK {
@@ -81,8 +81,6 @@ namespace ChimeraTK {
 
     void setCurrentVersionNumber(VersionNumber versionNumber) override;
 
-    std::list<EntityOwner*> getInputModulesRecursively(std::list<EntityOwner*> startList) override;
-
     size_t getCircularNetworkHash() override;
 
     /** Set the ID of the circular dependency network. This function can be called multiple times and throws if the
@@ -90,11 +88,57 @@ namespace ChimeraTK {
      */
     void setCircularNetworkHash(size_t circularNetworkHash);
 
+    /**
+     * Set the priority class of the module. The module thread is scheduled according to the priority class, and fan
+     * outs write to (and hence wake up) consumers of higher priority classes first, so control-loop modules see new
+     * values before background modules. Must be called before the connections are made, i.e. typically in the
+     * constructor of the module or of the application.
+     *
+     * Raising the scheduling policy to SCHED_FIFO requires the CAP_SYS_NICE capability (or a suitable RLIMIT_RTPRIO).
+     * If the permission is missing, a warning is printed and the thread runs with the default policy.
+     */
+    void setPriority(ModulePriority priority);
+
+    /** Return the priority class of the module, see setPriority(). */
+    ModulePriority getPriority() const { return _priority; }
+
+    /**
+     * Enable spinning before blocking in read() for all push-type inputs of this module. Before the thread is put to
+     * sleep, it spins for at most the given time if the next value is expected to arrive within that time, based on
+     * the learned inter-arrival time of each input (see AdaptiveSpinWait). This avoids the cost of sleeping and waking
+     * up in fast loops, at the expense of CPU time. A value of 0 (the default) disables spinning. The setting can be
+     * overridden for individual inputs with setReadSpinTime() of the accessor. Must be called before the connections
+     * are made. Spinning is always disabled in testable mode.
+     *
+     * Spinning covers the blocking read() of the inputs and CoalescingReadAnyGroup::readAny() of a group created with
+     * coalescingReadAnyGroup() (which spins on the group as a whole). A plain ReadAnyGroup::readAny() does not spin.
+     */
+    void setReadSpinTime(std::chrono::nanoseconds maxSpinTime);
+
+    /** Return the maximum spin time before blocking in read(), see setReadSpinTime(). */
+    std::chrono::nanoseconds getReadSpinTime() const { return _readSpinTime; }
+
+    /**
+     * Set the stack size of the module thread, overriding the stack size of the application (see
+     * Application::setThreadStackSize()). Useful for modules which need a particularly large stack (e.g. due to deep
+     * recursion or large local arrays), while all other threads use small stacks. A value of 0 (the default) uses the
+     * stack size of the application. Must be called before the application is started.
+     */
+    void setThreadStackSize(size_t stackSize);
+
+    /** Return the stack size of the module thread, 0 if the stack size of the application is used. See
+     *  setThreadStackSize(). */
+    size_t getThreadStackSize() const { return _threadStackSize; }
+
    protected:
     /** Wrapper around mainLoop(), to execute additional tasks in the thread
      * before entering the main loop */
     void mainLoopWrapper();
 
+    /** Read all consuming variables once to obtain their initial values. Must be called with the testable mode lock
+     *  held. Called by mainLoopWrapper() before entering mainLoop(). */
+    void readInitialValues();
+
     /** The thread executing mainLoop() */
     boost::thread moduleThread;
 
@@ -115,10 +159,14 @@ namespace ChimeraTK {
      */
     size_t _circularNetworkHash{0};
 
-    /** Helper needed to stop the recusion when detecting circular dependency networks.
-     *  Only used in the setp phase.
-     */
-    detail::CircularDependencyDetectionRecursionStopper _recursionStopper;
+    /** Priority class of the module, see setPriority() */
+    ModulePriority _priority{ModulePriority::normal};
+
+    /** Maximum spin time before blocking in read(), see setReadSpinTime() */
+    std::chrono::nanoseconds _readSpinTime{0};
+
+    /** Stack size of the module thread, see setThreadStackSize() */
+    size_t _threadStackSize{0};
   };
 
   /*********************************************************************************************************************/
@@ -46,6 +46,21 @@ namespace ChimeraTK {
 
     void writeIfDifferent(const std::vector<UserType>& newValue);
 
+    /**
+     * Mark the elements [first, first + count) as modified since the last write. If elements have been marked, the
+     * next write() only transfers the bounding range of all marked elements to device registers in the data path:
+     * Fan-outs copy only this range into the buffers of device registers, and only the affected window of the
+     * register is written to the device. All other consumers still receive the full array.
+     *
+     * The marked range is discarded with each write. If no element has been marked, the whole array is written as
+     * usual. Since the unmarked elements are not transferred, the application must not modify them without marking.
+     * Throws a ChimeraTK::logic_error if the range exceeds the array.
+     */
+    void markDirty(size_t first, size_t count = 1);
+
+    /** Mark the whole array as modified, so the next write() transfers the whole array regardless of markDirty(). */
+    void markAllDirty();
+
    protected:
     friend class InversionOfControlAccessor<ArrayAccessor<UserType>>;
 
@@ -141,6 +156,9 @@ namespace ChimeraTK {
   template<typename UserType>
   bool ArrayAccessor<UserType>::write() {
     auto versionNumber = this->getOwner()->getCurrentVersionNumber();
+    auto dirtyRange = this->node.getDirtyRange();
+    dirtyRange->beginWrite();
+    auto _ = cppext::finally([&] { dirtyRange->endWrite(); });
     bool dataLoss = ChimeraTK::OneDRegisterAccessor<UserType>::write(versionNumber);
     if(dataLoss) Application::incrementDataLossCounter(this->node.getQualifiedName());
     return dataLoss;
@@ -151,6 +169,9 @@ namespace ChimeraTK {
   template<typename UserType>
   bool ArrayAccessor<UserType>::writeDestructively() {
     auto versionNumber = this->getOwner()->getCurrentVersionNumber();
+    auto dirtyRange = this->node.getDirtyRange();
+    dirtyRange->beginWrite();
+    auto _ = cppext::finally([&] { dirtyRange->endWrite(); });
     bool dataLoss = ChimeraTK::OneDRegisterAccessor<UserType>::writeDestructively(versionNumber);
     if(dataLoss) Application::incrementDataLossCounter(this->node.getQualifiedName());
     return dataLoss;
@@ -161,11 +182,32 @@ namespace ChimeraTK {
   template<typename UserType>
   void ArrayAccessor<UserType>::writeIfDifferent(const std::vector<UserType>& newValue) {
     auto versionNumber = this->getOwner()->getCurrentVersionNumber();
+    // the new value is compared and written as a whole, so marked elements are irrelevant
+    this->node.getDirtyRange()->endWrite();
     ChimeraTK::OneDRegisterAccessor<UserType>::writeIfDifferent(newValue, versionNumber);
   }
 
   /********************************************************************************************************************/
 
+  template<typename UserType>
+  void ArrayAccessor<UserType>::markDirty(size_t first, size_t count) {
+    if(first + count > this->getNElements()) {
+      throw ChimeraTK::logic_error("ArrayAccessor::markDirty(): Range [" + std::to_string(first) + ", " +
+          std::to_string(first + count) + ") exceeds the array '" + this->node.getQualifiedName() + "' with " +
+          std::to_string(this->getNElements()) + " elements.");
+    }
+    this->node.getDirtyRange()->add(first, count);
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename UserType>
+  void ArrayAccessor<UserType>::markAllDirty() {
+    this->node.getDirtyRange()->addAll();
+  }
+
+  /********************************************************************************************************************/
+
   template<typename UserType>
   ArrayAccessor<UserType>::ArrayAccessor(Module* owner, const std::string& name, VariableDirection direction,
       std::string unit, size_t nElements, UpdateMode mode, const std::string& description,
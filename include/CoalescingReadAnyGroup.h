@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "AdaptiveSpinWait.h"
+
+#include <ChimeraTK/ReadAnyGroup.h>
+#include <ChimeraTK/TransferElementAbstractor.h>
+#include <ChimeraTK/VersionNumber.h>
+
+#include <chrono>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Variant of the ChimeraTK::ReadAnyGroup which processes all updates belonging to the same VersionNumber at once.
+   *
+   * If a single trigger causes several inputs of a module to be updated with the same VersionNumber, a mainLoop
+   * based on ReadAnyGroup::readAny() would run its computation once per input, each time on partially updated data.
+   * CoalescingReadAnyGroup::readAny() waits for the first update like ReadAnyGroup::readAny(), and then reads all
+   * further updates which are already available and carry the same VersionNumber, before returning the list of all
+   * updated elements. Hence each consistent update is processed only once.
+   *
+   * Updates are only collected as long as they are available without blocking. If an update with a different
+   * VersionNumber is encountered, collecting stops. Since this update has already been read, it will be returned by
+   * the next call to readAny() without blocking. This means that its value is already visible in the application
+   * buffer of the corresponding accessor when processing the preceding update.
+   *
+   * With setReadSpinTime(), readAny() spins before blocking, like a single read() of an input with a read spin time
+   * (see ApplicationModule::setReadSpinTime()). The inter-arrival time is learned for the group as a whole.
+   */
+  class CoalescingReadAnyGroup {
+   public:
+    /** Construct empty group. Elements can later be added using the add() function. */
+    CoalescingReadAnyGroup() = default;
+
+    /** Construct finalised group with the given elements. */
+    CoalescingReadAnyGroup(std::initializer_list<TransferElementAbstractor> list);
+
+    /** Add element to the group. This is only allowed before the group is finalised. */
+    void add(TransferElementAbstractor element);
+
+    /** Finalise the group, see ReadAnyGroup::finalise(). */
+    void finalise();
+
+    /** Wait until one of the elements in this group has received an update, then read all further updates with the same
+     *  VersionNumber which are already available. Returns the TransferElementIDs of all updated elements in the order
+     *  of reception. The returned reference stays valid until the next call to readAny(). */
+    const std::vector<TransferElementID>& readAny();
+
+    /** Return the VersionNumber of the updates returned by the last call to readAny(). */
+    VersionNumber getVersionNumber() const { return _version; }
+
+    /** Access the underlying ReadAnyGroup. Note that reading through it bypasses the coalescing. */
+    ReadAnyGroup& getReadAnyGroup() { return _group; }
+
+    /** Enable spinning before blocking in readAny(), see AdaptiveSpinWait. A value of 0 disables spinning.
+     *  Module::coalescingReadAnyGroup() sets the read spin time of the ApplicationModule (unless in testable mode). */
+    void setReadSpinTime(std::chrono::nanoseconds maxSpinTime);
+
+    /** Return the spin-then-block strategy of readAny(), or nullptr if spinning is disabled. */
+    const AdaptiveSpinWait* getSpinWait() const { return _spinWait ? &*_spinWait : nullptr; }
+
+    /** Name of the group listing the names of its elements, as reported by the IntrospectionServer while a thread is
+     *  waiting in readAny(). Set when the group is finalised. */
+    const std::string& getName() const { return *_name; }
+
+   private:
+    /** Find the element with the given ID */
+    const TransferElementAbstractor& getElement(const TransferElementID& id) const;
+
+    ReadAnyGroup _group;
+
+    /** All elements of the group, to obtain the version number of an update */
+    std::vector<TransferElementAbstractor> _elements;
+
+    /** IDs of the updated elements returned by the last readAny() */
+    std::vector<TransferElementID> _updates;
+
+    /** Update which has already been read but belongs to a different VersionNumber. Invalid if none. */
+    TransferElementID _pending;
+
+    VersionNumber _version{nullptr};
+
+    /** See getName(). The string is never modified but replaced, so the IntrospectionServer can hold a reference to
+     *  it while the group is destroyed. */
+    std::shared_ptr<const std::string> _name{std::make_shared<const std::string>()};
+
+    /** Present if spinning is enabled, see setReadSpinTime() */
+    std::optional<AdaptiveSpinWait> _spinWait;
+
+    /** Build _name from the element names */
+    void updateName();
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "VariableNetworkNode.h"
+
+#include <string>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  class Application;
+  class EntityOwner;
+
+  /********************************************************************************************************************/
+
+  /**
+   * Binary snapshot of the resolved connection model of an application, see Application::enableConnectionModelCache().
+   *
+   * The snapshot contains all VariableNetworks with their nodes (including trigger receivers and the control system,
+   * device and constant nodes created while resolving the connections) as they are after the networks have been
+   * finalised, optimised and checked. The realisation of the connections (e.g. the choice of the fan outs) follows
+   * deterministically from this model, so it is not stored.
+   *
+   * Application nodes are stored by the index of the accessor in the module tree. The snapshot is only used if the
+   * cache key matches, otherwise the connections are resolved as usual and the snapshot is replaced. The key is a hash
+   * over:
+   *  - the identity of the executable (size and modification time of /proc/self/exe) and the dynamic type of the
+   *    application, since the connections defined in the code cannot be hashed without evaluating them,
+   *  - the model version passed to Application::enableConnectionModelCache(),
+   *  - the module tree (names, types and properties of all modules and accessors),
+   *  - the register catalogues of all devices, which are expanded e.g. by ConnectingDeviceModule.
+   *
+   * The trigger overrun settings and the statistics groups created for them while resolving the connections (see
+   * Application::setTriggerOverrunPolicy()) are stored in the snapshot as well. The groups are not part of the key, they
+   * are re-created before the networks are restored.
+   *
+   * If the executable or the register catalogue of a device cannot be inspected, the cache is not used at all.
+   */
+  class ConnectionModelCache {
+   public:
+    ConnectionModelCache(Application& application, std::string fileName);
+
+    /** Restore the connection model from the cache file. Returns false without modifying the application if the file
+     *  does not exist, cannot be read or has been written with a different cache key. */
+    bool restore();
+
+    /** Write the connection model of the application to the cache file. This must be called after the networks have
+     *  been finalised and checked, but before the connections are realised. If the model cannot be represented (e.g.
+     *  an accessor of an unknown owner is involved), a warning is printed and no file is written. */
+    void save();
+
+   protected:
+    /** Collect all owners and accessors in a deterministic order, and compute the cache key over them and over the
+     *  executable, the model version and the device register catalogues */
+    void scanModuleTree();
+
+    /** Collect all owners and accessors in a deterministic order. The detail::TriggerStatistics groups are placed at
+     *  the end, after the _nKeyOwners owners which are part of the cache key. */
+    void collectOwners();
+
+    Application& _application;
+    std::string _fileName;
+
+    /** The cache key, see scanModuleTree() */
+    size_t _cacheKey{0};
+
+    /** False if the hash could not be computed, see scanModuleTree() */
+    bool _isCacheable{true};
+
+    /** All entity owners (the application itself, all modules and all DeviceModules with their submodules) */
+    std::vector<EntityOwner*> _owners;
+
+    /** Number of entries at the beginning of _owners which are part of the cache key, see collectOwners() */
+    size_t _nKeyOwners{0};
+
+    /** The accessors of all owners */
+    std::vector<VariableNetworkNode> _accessors;
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
@@ -45,8 +45,6 @@ namespace ChimeraTK {
 
     std::list<Module*> getSubmoduleList() const override;
 
-    std::list<EntityOwner*> getInputModulesRecursively(std::list<EntityOwner*> startList) override;
-
     size_t getCircularNetworkHash() override;
 
    protected:
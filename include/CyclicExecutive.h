@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "ApplicationModule.h"
+#include "ScalarAccessor.h"
+#include "VariableGroup.h"
+
+#include <ChimeraTK/TransferElementAbstractor.h>
+
+#include <list>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /*********************************************************************************************************************/
+
+  class CyclicExecutive;
+
+  /*********************************************************************************************************************/
+
+  /**
+   * ApplicationModule which implements its processing as a single step() instead of a mainLoop(). Such modules can
+   * be executed by a CyclicExecutive, which runs a chain of modules in a fixed order in a single thread once per
+   * trigger.
+   *
+   * If the module is not added to a CyclicExecutive, it runs in its own thread like any other ApplicationModule and
+   * executes step() after the initial values have been received and then each time one of its push-type inputs
+   * receives new data. In this case, the module must have at least one push-type input.
+   */
+  class CyclicModule : public ApplicationModule {
+   public:
+    using ApplicationModule::ApplicationModule;
+
+    /** To be implemented by the user: compute one cycle. All inputs are updated before (without blocking, inputs
+     *  without new data keep their previous value) and all outputs are written after each call. */
+    virtual void step() = 0;
+
+    void mainLoop() override;
+
+    void run() override;
+
+    /** Return the CyclicExecutive executing this module, or nullptr if the module runs in its own thread. */
+    CyclicExecutive* getExecutive() const { return _executive; }
+
+   protected:
+    friend class CyclicExecutive;
+
+    /** The CyclicExecutive executing this module, see CyclicExecutive::addModule() */
+    CyclicExecutive* _executive{nullptr};
+  };
+
+  /*********************************************************************************************************************/
+
+  /**
+   * Cyclic executive for hard real-time chains of modules. Each time the trigger input receives a value, all modules
+   * added with addModule() are executed in the order they have been added, in the thread of the CyclicExecutive:
+   * the inputs of the module are updated without blocking, then CyclicModule::step() is called and then all outputs
+   * are written. Since the predecessors in the chain have already written their outputs in the same cycle, the inputs
+   * see the data of the current cycle without any context switch. The order of the chain must hence follow the data
+   * flow between the modules.
+   *
+   * The data is not handed over directly from the buffer of the predecessor. The modules are connected like any other
+   * modules, and the inputs are updated with readLatest() from these connections (an SPSCChannel for 1:1 connections
+   * between modules, see createSPSCChannel()). Per input and cycle this costs a few non-blocking queue operations and a
+   * buffer swap, plus a copy of the data on the writing side. Since writer and reader run in the same thread, no
+   * thread is ever woken up.
+   *
+   * The CyclicExecutive has ModulePriority::realtime by default. Execution time statistics are published per cycle,
+   * both for the entire cycle and for each module in a VariableGroup named after the module.
+   */
+  class CyclicExecutive : public ApplicationModule {
+   public:
+    /**
+     * Create CyclicExecutive. The arguments are identical to the ones of the ApplicationModule.
+     */
+    CyclicExecutive(EntityOwner* owner, const std::string& name, const std::string& description,
+        HierarchyModifier hierarchyModifier = HierarchyModifier::none,
+        const std::unordered_set<std::string>& tags = {});
+
+    CyclicExecutive() { throw; } // work around for gcc bug: constructor must be present but is unused
+
+    /** Append the module to the chain of modules executed in each cycle. The module will not start its own thread.
+     *  Must be called before the connections are made, i.e. typically in the constructor of the application. */
+    void addModule(CyclicModule& module);
+
+    ScalarPushInput<uint64_t> trigger{this, "trigger", "", "Trigger to execute one cycle of all modules"};
+
+    ScalarOutput<double> cycleTime{this, "cycleTime", "ms", "Execution time of the last cycle"};
+    ScalarOutput<double> worstCycleTime{this, "worstCycleTime", "ms", "Longest execution time of a cycle so far"};
+    ScalarOutput<uint64_t> nOverruns{
+        this, "nOverruns", "", "Number of cycles which were not finished before the next trigger arrived"};
+
+    void mainLoop() override;
+
+    void terminate() override;
+
+   protected:
+    /** Execution time statistics of one module in the chain */
+    struct ModuleStatistics : public VariableGroup {
+      using VariableGroup::VariableGroup;
+
+      ScalarOutput<double> stepTime{this, "stepTime", "ms", "Execution time of the module in the last cycle"};
+      ScalarOutput<double> worstStepTime{this, "worstStepTime", "ms", "Longest execution time of the module so far"};
+    };
+
+    /** One module of the chain, with its accessors resolved once before entering the cycle */
+    struct ChainElement {
+      CyclicModule* module;
+      ModuleStatistics* statistics;
+      std::vector<TransferElementAbstractor*> inputs;
+      std::vector<TransferElementAbstractor*> outputs;
+    };
+
+    /** Execute one step of the given chain element and write its outputs. If updateInputs is true, the inputs are
+     *  updated before (without blocking). Returns the execution time in milliseconds. */
+    double execute(ChainElement& element, bool updateInputs);
+
+    /** Modules in the order of execution */
+    std::vector<ChainElement> _chain;
+
+    /** Statistics groups of all modules. A list, since the groups must not be moved. */
+    std::list<ModuleStatistics> _statistics;
+  };
+
+  /*********************************************************************************************************************/
+
+} /* namespace ChimeraTK */
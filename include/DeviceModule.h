@@ -58,6 +58,19 @@ namespace ChimeraTK {
       const DeviceModule* _myowner;
       std::string _registerNamePrefix;
     };
+
+    /** Statistics of a TriggerFanOut reading this device, see Application::setTriggerOverrunPolicy(). The groups are
+     *  created by the Application while resolving the connections and are written by the TriggerFanOut. */
+    struct TriggerStatistics : VariableGroup {
+      TriggerStatistics(DeviceModule* owner, const std::string& name);
+
+      ScalarOutput<double> cycleDuration{this, "cycleDuration", "ms",
+          "Time between receiving the trigger and distributing the data read from the device"};
+      ScalarOutput<uint64_t> nOverruns{
+          this, "nOverruns", "", "Number of cycles after which the next trigger had already arrived"};
+      ScalarOutput<uint64_t> nSkippedTriggers{
+          this, "nSkippedTriggers", "", "Number of stale triggers which have been discarded"};
+    };
   } // namespace detail
 
   /*********************************************************************************************************************/
@@ -192,8 +205,6 @@ namespace ChimeraTK {
      */
     void waitForInitialValues();
 
-    std::list<EntityOwner*> getInputModulesRecursively(std::list<EntityOwner*> startList) override;
-
     size_t getCircularNetworkHash() override;
 
     /**
@@ -201,6 +212,22 @@ namespace ChimeraTK {
      */
     std::string getDeviceAliasOrURI() const { return deviceAliasOrURI; }
 
+    /** Phases of the open/recovery procedure executed in the DeviceModule thread */
+    enum class RecoveryState {
+      opening,               ///< (Re-)opening the device, waiting for it to become functional
+      initialising,          ///< Running the initialisation handlers
+      writingRecoveryValues, ///< Writing the recovery accessors
+      functional,            ///< Device is functional, waiting for exceptions
+      waitingForTransfers    ///< Exception reported, waiting for running synchronous transfers to finish
+    };
+
+    /** Current phase of the open/recovery procedure. Can be called from any thread. */
+    RecoveryState getRecoveryState() const { return _recoveryState.load(std::memory_order_relaxed); }
+
+    /** Number of exceptions which have been processed since the application was started. Can be called from any
+     *  thread. */
+    uint64_t getExceptionCount() const { return _exceptionCount.load(std::memory_order_relaxed); }
+
    protected:
     // populate virtualisedModuleFromCatalog based on the information in the
     // device's catalogue
@@ -225,6 +252,10 @@ namespace ChimeraTK {
      * DeviceModule::defineConnections() */
     StatusWithMessage deviceError{this, "DeviceError/status", "Error status of the device"};
 
+    /** Statistics of the TriggerFanOuts reading this device, see Application::defineTriggerStatistics(). A std::list
+     *  is used since the groups must not be moved once they have been registered. */
+    std::list<detail::TriggerStatistics> triggerStatistics;
+
     /** The thread waiting for reportException(). It runs handleException() */
     boost::thread moduleThread;
 
@@ -270,6 +301,8 @@ namespace ChimeraTK {
     boost::latch initialValueLatch{1};
 
     std::atomic<int64_t> synchronousTransferCounter{0};
+    std::atomic<RecoveryState> _recoveryState{RecoveryState::opening};
+    std::atomic<uint64_t> _exceptionCount{0};
     std::atomic<uint64_t> writeOrderCounter{0};
 
     std::list<RegisterPath> writeRegisterPaths;
@@ -289,6 +322,8 @@ namespace ChimeraTK {
     friend class ConnectingDeviceModule;
 
     friend class StatusAggregator;
+
+    friend class ConnectionModelCache;
   };
 
   /*********************************************************************************************************************/
@@ -332,6 +367,11 @@ namespace ChimeraTK {
    protected:
     void defineConnections() override;
 
+    /// Add the initialisation handler (if any) to the DeviceModule. Called by defineConnections(), and by the
+    /// ConnectionModelCache when restoring the connections instead.
+    void addInitialisationHandlerToDevice();
+    friend class ConnectionModelCache;
+
     std::string pathToConnectTo;
     std::string triggerPath;
     std::string pathInDevice;
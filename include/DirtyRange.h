@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Range of elements of an array which have been modified by the application since the last write. One instance
+   * exists per feeding network node, shared between the application accessor (which marks the modified elements, see
+   * ArrayAccessor::markDirty()) and the implementations in the data path which can make use of partial updates (the
+   * FeedingFanOut and the ExceptionHandlingDecorator of device registers).
+   *
+   * The marked elements are collected into a single bounding range. The range is only handed to the data path while
+   * the write is in progress, i.e. between beginWrite() and endWrite(), which are both executed in the thread of the
+   * writing application module. Outside of a write, and for writes without any marked elements, isPartial() returns
+   * false and the whole array has to be transferred.
+   *
+   * The members are intentionally not atomic: the object must only be used from the thread of the writing application
+   * module. This holds for all users listed above, since the FeedingFanOut and the ExceptionHandlingDecorator evaluate
+   * the range synchronously inside the write() of the application accessor. An implementation which hands the data
+   * over to another thread (e.g. through a queue) must not access the range.
+   */
+  class DirtyRange {
+   public:
+    /** Add the elements [first, first + count) to the pending range */
+    void add(size_t first, size_t count) {
+      if(count == 0) return;
+      if(_count == 0) {
+        _first = first;
+        _count = count;
+        return;
+      }
+      size_t end = std::max(_first + _count, first + count);
+      _first = std::min(_first, first);
+      _count = end - _first;
+    }
+
+    /** Mark the whole array as modified. The next write will transfer the whole array. */
+    void addAll() { _all = true; }
+
+    /** Make the pending range visible to the data path. To be called right before the write. */
+    void beginWrite() { _active = !_all && _count != 0; }
+
+    /** Discard the range after the write has been completed (or has failed). */
+    void endWrite() {
+      _active = false;
+      _all = false;
+      _first = 0;
+      _count = 0;
+    }
+
+    /** Whether the write currently in progress modifies only the elements [first(), first() + count()). */
+    bool isPartial() const { return _active; }
+
+    size_t first() const { return _first; }
+
+    size_t count() const { return _count; }
+
+   private:
+    size_t _first{0};
+    size_t _count{0};
+    bool _all{false};
+    bool _active{false};
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
@@ -209,9 +209,6 @@ namespace ChimeraTK {
      *  incrementDataFaultCounter(). */
     virtual void decrementDataFaultCounter() = 0;
 
-    /** Use pointer to the module as unique identifier.*/
-    virtual std::list<EntityOwner*> getInputModulesRecursively(std::list<EntityOwner*> startList) = 0;
-
     /** Get the ID of the circular dependency network (0 if none). This information is only available after
      *  the Application has finalised all connections.
      */
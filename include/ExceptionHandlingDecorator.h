@@ -7,6 +7,8 @@
 
 #include <ChimeraTK/NDRegisterAccessorDecorator.h>
 
+#include <map>
+
 namespace ChimeraTK {
 
   /** Decorator of the NDRegisterAccessor which facilitates tests of the
@@ -49,6 +51,20 @@ namespace ChimeraTK {
     // used to fill in data.
     boost::shared_ptr<NDRegisterAccessor<UserType>> _recoveryAccessor{nullptr};
 
+    // Range of modified elements of the feeding application accessor (writable registers only). For partial writes,
+    // only this range is copied into the recovery accessor and written through the _windowAccessor.
+    std::shared_ptr<DirtyRange> _dirtyRange;
+    std::string _deviceAlias;
+    // Accessors for the windows written so far, keyed by (first, count). The cache is cleared when it exceeds
+    // maxWindowAccessors entries.
+    std::map<std::pair<size_t, size_t>, boost::shared_ptr<NDRegisterAccessor<UserType>>> _windowAccessors;
+    static constexpr size_t maxWindowAccessors{16};
+    // Accessor of the window written in the current transfer
+    boost::shared_ptr<NDRegisterAccessor<UserType>> _windowAccessor;
+    size_t _windowFirst{0};
+    size_t _windowCount{0};
+    bool _isPartialWrite{false};
+
     VariableDirection _direction;
 
     // We have to throw in read transfers because the outermost TransferElement has to see the exception
@@ -6,7 +6,9 @@
 
 #include <ChimeraTK/NDRegisterAccessor.h>
 
+#include <algorithm>
 #include <list>
+#include <unordered_map>
 #include <utility>
 
 namespace ChimeraTK {
@@ -54,10 +56,28 @@ namespace ChimeraTK {
     // interrupt the input and all slaves
     virtual void interrupt();
 
+    /** Return the highest priority class of the modules owning the slaves, see ApplicationModule::setPriority(). A
+     *  FanOut without slaves has normal priority. */
+    ModulePriority getHighestSlavePriority() const {
+      return _slavePriorities.empty() ? ModulePriority::normal : _highestSlavePriority;
+    }
+
    protected:
+    /** Insert the slave into the list of slaves, ordered by the priority class of the consumer. Slaves of higher
+     *  priority classes come first, so they are written (and their consumers are woken up) first. Slaves of the same
+     *  priority class keep the order in which they were added. */
+    void insertSlave(
+        boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> slave, const VariableNetworkNode& consumer);
+
     boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> impl;
 
     std::list<boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>> slaves;
+
+    /** Priority class of the consumer of each slave */
+    std::unordered_map<ChimeraTK::TransferElement*, ModulePriority> _slavePriorities;
+
+    /** Highest priority class in _slavePriorities */
+    ModulePriority _highestSlavePriority{ModulePriority::low};
   };
 
   /********************************************************************************************************************/
@@ -65,7 +85,7 @@ namespace ChimeraTK {
 
   template<typename UserType>
   void FanOut<UserType>::addSlave(
-      boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> slave, VariableNetworkNode& /*consumer*/) {
+      boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> slave, VariableNetworkNode& consumer) {
     if(!slave->isWriteable()) {
       throw ChimeraTK::logic_error("FanOut::addSlave() has been called with a "
                                    "receiving implementation!");
@@ -85,7 +105,20 @@ namespace ChimeraTK {
           std::to_string(slave->getNumberOfSamples());
       throw ChimeraTK::logic_error(what.c_str());
     }
-    slaves.push_back(slave);
+    insertSlave(slave, consumer);
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename UserType>
+  void FanOut<UserType>::insertSlave(
+      boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> slave, const VariableNetworkNode& consumer) {
+    auto priority = consumer.getPriority();
+    auto it = slaves.begin();
+    while(it != slaves.end() && _slavePriorities.at(it->get()) >= priority) ++it;
+    slaves.insert(it, slave);
+    _slavePriorities[slave.get()] = priority;
+    _highestSlavePriority = std::max(_highestSlavePriority, priority);
   }
 
   /********************************************************************************************************************/
@@ -105,6 +138,10 @@ namespace ChimeraTK {
     size_t nOld = slaves.size();
     slaves.remove(slave_typed);
     assert(slaves.size() == nOld - 1);
+
+    _slavePriorities.erase(slave_typed.get());
+    _highestSlavePriority = ModulePriority::low;
+    for(auto& p : _slavePriorities) _highestSlavePriority = std::max(_highestSlavePriority, p.second);
   }
 
   /********************************************************************************************************************/
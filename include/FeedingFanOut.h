@@ -2,11 +2,15 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 #pragma once
 
+#include "DirtyRange.h"
 #include "FanOut.h"
 
 #include <ChimeraTK/NDRegisterAccessor.h>
 
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <set>
 #include <sstream>
 
 namespace ChimeraTK {
@@ -58,6 +62,10 @@ namespace ChimeraTK {
 
     boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> getReturnSlave() { return _returnSlave; }
 
+    /** Set the range of modified elements of the feeding application accessor. During partial writes, only this range
+     *  is copied into the buffers of slaves which are device registers. */
+    void setDirtyRange(std::shared_ptr<const DirtyRange> dirtyRange) { _dirtyRange = std::move(dirtyRange); }
+
     void interrupt() override;
 
    protected:
@@ -74,6 +82,12 @@ namespace ChimeraTK {
 
     /// DataValidity to attach to the data
     DataValidity validity{DataValidity::ok};
+
+    /// Range of modified elements, see setDirtyRange()
+    std::shared_ptr<const DirtyRange> _dirtyRange;
+
+    /// Slaves which only use the dirty range of their buffer during partial writes (device registers)
+    std::set<boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>> _partialUpdateSlaves;
   };
 
   /********************************************************************************************************************/
@@ -103,7 +117,7 @@ namespace ChimeraTK {
 
   template<typename UserType>
   void FeedingFanOut<UserType>::addSlave(
-      boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> slave, VariableNetworkNode&) {
+      boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> slave, VariableNetworkNode& consumer) {
     // check if array shape is compatible, unless the receiver is a trigger
     // node, so no data is expected
     if(slave->getNumberOfSamples() != 0 &&
@@ -140,8 +154,10 @@ namespace ChimeraTK {
       }
     }
 
-    // add the slave
-    FanOut<UserType>::slaves.push_back(slave);
+    // add the slave, ordered by priority class. Device registers are written through the ExceptionHandlingDecorator,
+    // which only takes the dirty range from the buffer during partial writes.
+    FanOut<UserType>::insertSlave(slave, consumer);
+    if(consumer.getType() == NodeType::Device) _partialUpdateSlaves.insert(slave);
   }
 
   /********************************************************************************************************************/
@@ -195,11 +211,17 @@ namespace ChimeraTK {
   template<typename UserType>
   void FeedingFanOut<UserType>::doPreWrite(TransferType, VersionNumber) {
     if(this->_disabled) return;
+    const bool isPartial = _dirtyRange && _dirtyRange->isPartial() && !_partialUpdateSlaves.empty();
     for(auto& slave : FanOut<UserType>::slaves) {       // send out copies to slaves
       if(slave->getNumberOfSamples() != 0) {            // do not send copy if no data is expected (e.g. trigger)
         if(slave == FanOut<UserType>::slaves.front()) { // in case of first slave, swap instead of copy
           slave->accessChannel(0).swap(ChimeraTK::NDRegisterAccessor<UserType>::buffer_2D[0]);
         }
+        else if(isPartial && _partialUpdateSlaves.count(slave)) { // device register: only copy the modified elements
+          auto first = FanOut<UserType>::slaves.front()->accessChannel(0).begin() + long(_dirtyRange->first());
+          std::copy(first, first + long(_dirtyRange->count()),
+              slave->accessChannel(0).begin() + long(_dirtyRange->first()));
+        }
         else { // not the first slave: copy the data from the first slave
           slave->accessChannel(0) = FanOut<UserType>::slaves.front()->accessChannel(0);
         }
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "ArrayAccessor.h"
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Array accessor with a number of elements fixed at compile time. Note for users: Use the convenience classes
+   * FixedArrayPushInput, FixedArrayPollInput and FixedArrayOutput instead of this class directly.
+   *
+   * The data is stored in the same buffer as for the regular ArrayAccessor, so the fixed-size accessors can be
+   * connected to any other variable with N elements. The size is checked when the connections are made, like for any
+   * other variable. Since size() is a compile-time constant, loops over the elements have a constant trip count and can
+   * be fully unrolled and vectorised by the compiler. For the best results in hot loops, obtain the pointer with
+   * begin() once per loop and index it, since the compiler cannot always prove that the buffer does not move between
+   * two element accesses. The pointer is invalidated by each read or write operation.
+   */
+  template<typename UserType, size_t N, template<typename> class AccessorType>
+  class FixedArrayAccessor : public AccessorType<UserType> {
+   public:
+    static_assert(N > 0, "FixedArrayAccessor must have at least one element.");
+
+    FixedArrayAccessor(Module* owner, const std::string& name, std::string unit, const std::string& description,
+        const std::unordered_set<std::string>& tags = {})
+    : AccessorType<UserType>(owner, name, unit, N, description, tags) {}
+
+    FixedArrayAccessor() = default;
+
+    using AccessorType<UserType>::operator=;
+
+    /** Number of elements, available at compile time */
+    static constexpr size_t size() { return N; }
+
+    UserType& operator[](size_t element) { return this->data()[element]; }
+
+    const UserType& operator[](size_t element) const {
+      return const_cast<FixedArrayAccessor*>(this)->data()[element];
+    }
+
+    /** Pointer to the first element. Valid until the next read or write operation. */
+    UserType* begin() { return this->data(); }
+
+    /** Pointer behind the last element. Valid until the next read or write operation. */
+    UserType* end() { return this->data() + N; }
+
+    /** Copy the value into a std::array */
+    operator std::array<UserType, N>() const {
+      std::array<UserType, N> value;
+      for(size_t i = 0; i < N; ++i) value[i] = (*this)[i];
+      return value;
+    }
+
+    /** Assign the value from a std::array */
+    FixedArrayAccessor& operator=(const std::array<UserType, N>& value) {
+      UserType* target = this->data();
+      for(size_t i = 0; i < N; ++i) target[i] = value[i];
+      return *this;
+    }
+  };
+
+  /********************************************************************************************************************/
+
+  /** Convenience class for input array accessors with a fixed number of elements and UpdateMode::push */
+  template<typename UserType, size_t N>
+  using FixedArrayPushInput = FixedArrayAccessor<UserType, N, ArrayPushInput>;
+
+  /** Convenience class for input array accessors with a fixed number of elements and UpdateMode::poll */
+  template<typename UserType, size_t N>
+  using FixedArrayPollInput = FixedArrayAccessor<UserType, N, ArrayPollInput>;
+
+  /** Convenience class for output array accessors with a fixed number of elements (always UpdateMode::push) */
+  template<typename UserType, size_t N>
+  using FixedArrayOutput = FixedArrayAccessor<UserType, N, ArrayOutput>;
+
+  /********************************************************************************************************************/
+
+} /* namespace ChimeraTK */
@@ -53,6 +53,29 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  /** Enum to define how a TriggerFanOut handles triggers which have arrived while the previous trigger was still being
+   *  processed (trigger overrun). See Application::setTriggerOverrunPolicy(). */
+  enum class TriggerOverrunPolicy {
+    processAll, ///< Process every trigger, even if it is already stale. This is the default.
+    skipStale   ///< Discard all queued triggers and read the data only once for the newest trigger.
+  };
+
+  /********************************************************************************************************************/
+
+  /**
+   * Enum to define the priority class of an ApplicationModule, see ApplicationModule::setPriority(). The priority
+   * class determines the scheduling policy of the module thread and the order in which fan outs write to and hence
+   * wake up the consumers of a variable.
+   */
+  enum class ModulePriority {
+    low,     ///< Background processing. The thread is scheduled with SCHED_BATCH.
+    normal,  ///< Default. The scheduling policy of the thread is not changed.
+    high,    ///< Control loop. The thread is scheduled with SCHED_FIFO at a low real-time priority.
+    realtime ///< Time critical control loop. The thread is scheduled with SCHED_FIFO at a high real-time priority.
+  };
+
+  /********************************************************************************************************************/
+
   /** Enum to define the life-cycle states of an Application. */
   enum class LifeCycleState {
     initialisation, ///< Initialisation phase including ApplicationModule::prepare(). Single threaded operation. All
@@ -3,10 +3,9 @@
 #pragma once
 
 #include "ApplicationModule.h"
+#include "StringInterner.h"
 #include "VariableGroup.h"
 
-#include <boost/algorithm/string.hpp>
-
 namespace ChimeraTK {
 
   /********************************************************************************************************************/
@@ -49,7 +48,9 @@ namespace ChimeraTK {
         bool eliminateFirstHierarchy, bool negate, VirtualModule& root) const override;
 
     bool moveToRoot{false};
-    std::vector<std::string> _splittedPath;
+
+    /** Cleaned path components of the qualified name, see StringInterner */
+    std::vector<StringInterner::Id> _splittedPath;
   };
 
   /********************************************************************************************************************/
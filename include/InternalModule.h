@@ -40,22 +40,12 @@ namespace ChimeraTK {
     DataValidity getDataValidity() const override { throw; }
     void incrementDataFaultCounter() override { throw; }
     void decrementDataFaultCounter() override { throw; }
-    std::list<EntityOwner*> getInputModulesRecursively([[maybe_unused]] std::list<EntityOwner*> startList) override;
     size_t getCircularNetworkHash() override;
   };
 
   /********************************************************************************************************************/
   /********************************************************************************************************************/
 
-  inline std::list<EntityOwner*> InternalModule::getInputModulesRecursively(
-      [[maybe_unused]] std::list<EntityOwner*> startList) {
-    throw ChimeraTK::logic_error("getInputModulesRecursively() called on an InternalModule (ThreadedFanout or "
-                                 "TriggerFanout). This is probably "
-                                 "caused by incorrect ownership of variables/accessors or VariableGroups.");
-  }
-
-  /********************************************************************************************************************/
-
   inline size_t InternalModule::getCircularNetworkHash() {
     throw ChimeraTK::logic_error("getCircularNetworkHash() called on an InternalModule (ThreadedFanout or "
                                  "TriggerFanout). This is probably "
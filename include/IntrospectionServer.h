@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "ThreadStack.h"
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  class Application;
+  class MetaDataPropagationFlagProvider;
+  class TransferElement;
+
+  /********************************************************************************************************************/
+
+  namespace detail {
+
+    /**
+     * State of a thread registered with Application::registerThread(), as reported by the IntrospectionServer. The
+     * owning thread updates the state with atomic stores only, so keeping it up to date is cheap.
+     */
+    struct ThreadStatus {
+      explicit ThreadStatus(std::string threadName) : name(std::move(threadName)) {}
+
+      /** Name of the thread as passed to Application::registerThread() */
+      const std::string name;
+
+      /** Accessor the thread is currently waiting on in a blocking read, or nullptr */
+      std::atomic<const MetaDataPropagationFlagProvider*> blockedOn{nullptr};
+
+      /** Name of the group the thread is currently waiting on in CoalescingReadAnyGroup::readAny(), or nullptr. The
+       *  name is owned jointly with the group, since the group may be destroyed while the report is generated. Access
+       *  only with std::atomic_load() and std::atomic_store(). */
+      std::shared_ptr<const std::string> blockedOnGroup;
+
+      /** Stack of the thread, empty if unknown or if the thread has terminated. Protected by stackMutex, which is
+       *  taken by the thread only when it terminates, so the stack is not scanned after it has been released. */
+      ThreadStack::Bounds stack;
+      std::mutex stackMutex;
+    };
+
+    /** Status of the current thread, or nullptr if the thread has not been registered */
+    inline thread_local std::shared_ptr<ThreadStatus> currentThreadStatus;
+
+  } // namespace detail
+
+  /********************************************************************************************************************/
+
+  /**
+   * Local introspection endpoint for a running application, see Application::enableIntrospectionSocket().
+   *
+   * The server listens on a Unix domain socket. Each client connecting to the socket receives a plain-text report and
+   * the connection is closed, so e.g. "socat - UNIX-CONNECT:<path>" prints the current state. The report lists:
+   *  - each registered thread and the variable or CoalescingReadAnyGroup it is currently blocked on (if any; waiting
+   *    in a plain ReadAnyGroup::readAny() is not reported),
+   *  - the stack size and the stack high-water mark of each registered thread (see Application::setThreadStackSize()),
+   *  - for each application variable the number of values waiting in its queue, the time stamp of the last version
+   *    number, the number of transfers and the data validity,
+   *  - the recovery state of each DeviceModule.
+   *
+   * All information is taken from atomic variables maintained by the accessors and modules themselves, so answering a
+   * request never takes a lock which is used by the application threads.
+   */
+  class IntrospectionServer {
+   public:
+    /** Create the socket and start the server thread. Throws ChimeraTK::runtime_error if the socket cannot be
+     *  created. An existing file at the socket path is replaced. */
+    IntrospectionServer(Application& application, const std::string& socketPath);
+
+    /** Stop the server thread and remove the socket */
+    ~IntrospectionServer();
+
+    /** Create the report which is sent to each client */
+    std::string report();
+
+   protected:
+    /** Function executed in the server thread */
+    void serve();
+
+    struct Variable {
+      boost::shared_ptr<TransferElement> accessor;  // keeps the decorator alive
+      MetaDataPropagationFlagProvider* flagProvider; // the same object as accessor
+    };
+
+    Application& _application;
+    std::string _socketPath;
+    int _socket{-1};
+    std::vector<Variable> _variables;
+    boost::thread _thread;
+  };
+
+  /********************************************************************************************************************/
+
+} /* namespace ChimeraTK */
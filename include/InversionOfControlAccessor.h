@@ -7,6 +7,7 @@
 
 #include <boost/smart_ptr/shared_ptr.hpp>
 
+#include <chrono>
 #include <string>
 
 namespace ChimeraTK {
@@ -38,6 +39,10 @@ namespace ChimeraTK {
      * characters (i.e. no spaces and no special characters). */
     void addTags(const std::unordered_set<std::string>& tags);
 
+    /** Set the maximum spin time before blocking in read() for this input, overriding the setting of the owning
+     *  module. A value of 0 disables spinning for this input. See ApplicationModule::setReadSpinTime(). */
+    void setReadSpinTime(std::chrono::nanoseconds maxSpinTime) { node.setReadSpinTime(maxSpinTime); }
+
     /** Convert into VariableNetworkNode */
     operator VariableNetworkNode() { return node; }
     operator const VariableNetworkNode() const { return node; }
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Helper functions to avoid page faults and TLB misses for the buffers of the application, see
+   * Application::enableMemoryLocking().
+   *
+   * Large array buffers are allocated by malloc as separate anonymous memory mappings. These mappings are found in
+   * /proc/self/maps, so no special allocator is needed and the buffers can still be swapped freely between accessors.
+   */
+  class MemoryLocking {
+   public:
+    /** Address range of a memory mapping */
+    struct Region {
+      uintptr_t begin;
+      uintptr_t end;
+    };
+
+    /** Parse the content of /proc/self/maps and return all private, anonymous, writable mappings (including the heap)
+     *  of at least minimumSize bytes. Thread stacks (mappings directly preceded by a small guard mapping) and other
+     *  special mappings are excluded. */
+    static std::vector<Region> findLargeAnonymousRegions(std::istream& maps, size_t minimumSize);
+
+    /** Return the size of transparent huge pages, or 0 if transparent huge pages are not available. */
+    static size_t getHugePageSize();
+
+    /** Advise the kernel to back the huge-page aligned parts of the given regions with transparent huge pages. Where
+     *  supported, the pages are collapsed into huge pages immediately. Returns the number of bytes advised. */
+    static size_t adviseHugePages(const std::vector<Region>& regions, size_t hugePageSize);
+
+    /** Lock all current memory of the process, which faults in all pages now. Future allocations are not affected.
+     *  Returns false and sets the error message if this is not possible (e.g. if RLIMIT_MEMLOCK is too low). */
+    static bool lockCurrent(std::string& error);
+
+    /** Lock all current and future memory of the process when it is faulted in (MCL_ONFAULT). Pages which are already
+     *  resident stay locked, but no pages are faulted in, so e.g. the unused parts of thread stacks do not consume RAM.
+     *  Returns false and sets the error message if this is not possible (e.g. if RLIMIT_MEMLOCK is too low or the
+     *  kernel does not support MCL_ONFAULT). */
+    static bool lockOnFault(std::string& error);
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
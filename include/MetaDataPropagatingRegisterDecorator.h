@@ -2,14 +2,22 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 #pragma once
 
+#include "AdaptiveSpinWait.h"
+
 #include <ChimeraTK/NDRegisterAccessorDecorator.h>
 
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+
 namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
   // we can only declare the classes here but not use them/include the header to avoid a circular dependency
   class EntityOwner;
+  class Module;
   class VariableNetworkNode;
 
   /********************************************************************************************************************/
@@ -21,7 +29,34 @@ namespace ChimeraTK {
    public:
     DataValidity getLastValidity() const { return lastValidity; }
 
+    /** Qualified name of the decorated application variable, used by the IntrospectionServer */
+    const std::string& getQualifiedName() const { return _qualifiedName; }
+
+    /** Number of values waiting in the read queue. Returns 0 for variables without AccessMode::wait_for_new_data. */
+    virtual size_t getQueueFillLevel() = 0;
+
+    /** Time stamp of the version number of the last transferred value in nanoseconds since the epoch (0 if no value
+     *  has been transferred yet). This is atomic to allow the IntrospectionServer to access this information. */
+    int64_t getLastVersionTime() const { return _lastVersionTime.load(std::memory_order_relaxed); }
+
+    /** Number of values transferred so far (read or written). This is atomic to allow the IntrospectionServer to
+     *  access this information. */
+    uint64_t getTransferCount() const { return _transferCount.load(std::memory_order_relaxed); }
+
+    /** Returns true once this output has been written after the owning module has entered its mainLoop(). Writes in
+     *  prepare() do not count. Used for the ordered initial values, see Application::enableOrderedInitialValues(). */
+    bool hasPublishedInitialValue() const { return _initialValuePublished.load(std::memory_order_acquire); }
+
    protected:
+    /** Update the introspection information after a transfer with the given version number */
+    void countTransfer(const VersionNumber& versionNumber) {
+      _lastVersionTime.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 versionNumber.getTime().time_since_epoch())
+                                 .count(),
+          std::memory_order_relaxed);
+      _transferCount.store(_transferCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
     /**
      *  Flag whether this is decorating a circular input
      */
@@ -33,6 +68,13 @@ namespace ChimeraTK {
      */
     std::atomic<DataValidity> lastValidity{DataValidity::ok};
 
+    /** Set by the VariableNetworkNode when the decorator is created */
+    std::string _qualifiedName;
+
+    std::atomic<int64_t> _lastVersionTime{0};
+    std::atomic<uint64_t> _transferCount{0}; // only modified by the thread using the accessor
+    std::atomic<bool> _initialValuePublished{false};
+
     // The VariableNetworkNode needs access to _isCircularInput. It cannot be set at construction time because the
     // network is not complete yet and isCircularInput is not know at that moment.
     friend class VariableNetworkNode;
@@ -44,22 +86,47 @@ namespace ChimeraTK {
    *  NDRegisterAccessorDecorator which propagates meta data attached to input process variables through the owning
    *  ApplicationModule. It will set the current version number of the owning ApplicationModule in postRead. At the
    *  same time it will also propagate the DataValidity flag to/from the owning module.
+   *
+   *  This is the only decorator on the application side of an application accessor. Optional features are selected
+   *  when the connection is made (see VariableNetworkNode::setAppAccessorImplementation()) and handled directly in the
+   *  hooks of this decorator, instead of stacking further decorators which each add a buffer swap and a chain of
+   *  virtual calls per transfer. Properties of the target needed in each transfer are determined at construction.
    */
   template<typename T>
   class MetaDataPropagatingRegisterDecorator : public NDRegisterAccessorDecorator<T, T>,
                                                public MetaDataPropagationFlagProvider {
    public:
-    MetaDataPropagatingRegisterDecorator(const boost::shared_ptr<NDRegisterAccessor<T>>& target, EntityOwner* owner)
-    : NDRegisterAccessorDecorator<T, T>(target), _owner(owner) {}
+    /** If readSpinTime is non-zero, blocking reads spin on the read queue of the target for up to the given time
+     *  before putting the thread to sleep, see AdaptiveSpinWait and ApplicationModule::setReadSpinTime(). */
+    MetaDataPropagatingRegisterDecorator(const boost::shared_ptr<NDRegisterAccessor<T>>& target, EntityOwner* owner,
+        std::chrono::nanoseconds readSpinTime = std::chrono::nanoseconds(0));
 
-    void doPreRead(TransferType type) override { NDRegisterAccessorDecorator<T, T>::doPreRead(type); }
+    void doPreRead(TransferType type) override;
 
     void doPostRead(TransferType type, bool hasNewData) override;
     void doPreWrite(TransferType type, VersionNumber versionNumber) override;
+    void doPostWrite(TransferType type, VersionNumber versionNumber) override;
+
+    size_t getQueueFillLevel() override;
+
+    /** Return the spin strategy of reads, e.g. to obtain statistics. Returns nullptr if read spinning is disabled. */
+    const AdaptiveSpinWait* getSpinWait() const { return _spinWait ? &*_spinWait : nullptr; }
 
    protected:
     EntityOwner* _owner;
 
+    /** ApplicationModule owning the variable (nullptr if the owner is not a Module) */
+    Module* _applicationModule{nullptr};
+
+    /** Whether the target has AccessMode::wait_for_new_data. getAccessModeFlags() returns a copy, so this is cached. */
+    bool _isPushType;
+
+    /** Read spinning, only present if enabled */
+    std::optional<AdaptiveSpinWait> _spinWait;
+
+    /** Read queue of the target, on which the read spinning is done */
+    cppext::future_queue<void> _targetQueue;
+
     using TransferElement::_dataValidity;
     using NDRegisterAccessorDecorator<T>::_target;
     using NDRegisterAccessorDecorator<T>::buffer_2D;
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 #pragma once
 
+#include "CoalescingReadAnyGroup.h"
 #include "EntityOwner.h"
 #include "VariableNetworkNode.h"
 
@@ -63,9 +64,14 @@ namespace ChimeraTK {
     virtual void terminate(){};
 
     /** Create a ChimeraTK::ReadAnyGroup for all readable variables in this
-     * Module. */
+     * Module. Its readAny() does not spin before blocking, see ApplicationModule::setReadSpinTime(). */
     ChimeraTK::ReadAnyGroup readAnyGroup();
 
+    /** Create a ChimeraTK::CoalescingReadAnyGroup for all readable variables in this Module. Its readAny() processes
+     *  all updates with the same VersionNumber at once, and spins before blocking according to the read spin time of
+     *  the ApplicationModule (see ApplicationModule::setReadSpinTime()). */
+    ChimeraTK::CoalescingReadAnyGroup coalescingReadAnyGroup();
+
     /** Read all readable variables in the group. If there are push-type variables in the group, this call will block
      *  until all of the variables have received an update. All push-type variables are read first, the poll-type
      *  variables are therefore updated with the latest values upon return.
@@ -153,8 +159,6 @@ namespace ChimeraTK {
 
     void decrementDataFaultCounter() override { _owner->decrementDataFaultCounter(); }
 
-    std::list<EntityOwner*> getInputModulesRecursively(std::list<EntityOwner*> startList) override;
-
     size_t getCircularNetworkHash() override { return _owner->getCircularNetworkHash(); }
 
     /**
@@ -0,0 +1,249 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "AdaptiveSpinWait.h"
+
+#include <ChimeraTK/NDRegisterAccessor.h>
+
+#include <boost/make_shared.hpp>
+
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  namespace detail {
+
+    /**
+     * Shared state of an SPSCChannel: a ring buffer of preallocated slots. Exactly one thread writes (through the
+     * SPSCSender) and exactly one thread reads (through the SPSCReceiver).
+     *
+     * Each slot carries its own state, so the sender can overwrite the most recent slot when the ring is full (which is
+     * the same "data lost" semantics as for the ProcessArray) without racing with the receiver. The number of values in
+     * the ring is mirrored by the number of elements in the notification queue of the receiver, which is the only part
+     * involving a system call (and only if the receiver actually has to block). The notification queue has one
+     * additional element reserved for the exception pushed by SPSCReceiver::interrupt(), so an interrupt never
+     * replaces the notification of a value.
+     */
+    template<typename UserType>
+    struct SPSCChannelState {
+      SPSCChannelState(size_t nElements, size_t capacity) : slots(capacity) {
+        for(auto& slot : slots) slot.buffer.resize(nElements);
+      }
+
+      enum SlotState : int { empty = 0, full = 1, busy = 2 };
+
+      struct Slot {
+        std::atomic<int> state{empty};
+        std::vector<UserType> buffer;
+        VersionNumber version{nullptr};
+        DataValidity validity{DataValidity::ok};
+      };
+
+      std::vector<Slot> slots;
+      alignas(64) std::atomic<size_t> head{0}; // only modified by the sender
+      alignas(64) std::atomic<size_t> tail{0}; // only modified by the receiver
+      cppext::future_queue<void> notifications{slots.size() + 1};
+    };
+
+  } // namespace detail
+
+  /********************************************************************************************************************/
+
+  /**
+   * Sending end of an SPSCChannel, see createSPSCChannel(). The sender is write-only. A write never blocks. If the
+   * receiver has not yet consumed the previous values and the queue is full, the most recent value in the queue is
+   * overwritten and the write returns true (data lost).
+   */
+  template<typename UserType>
+  class SPSCSender : public NDRegisterAccessor<UserType> {
+   public:
+    SPSCSender(boost::shared_ptr<detail::SPSCChannelState<UserType>> state, const std::string& name,
+        AccessModeFlags flags, const std::string& unit, const std::string& description)
+    : NDRegisterAccessor<UserType>(name, flags, unit, description), _state(std::move(state)) {
+      this->buffer_2D.resize(1);
+      this->buffer_2D[0].resize(_state->slots[0].buffer.size());
+    }
+
+    void doReadTransferSynchronously() override {
+      throw ChimeraTK::logic_error("Read operation called on write-only variable " + this->getName());
+    }
+
+    bool doWriteTransfer(ChimeraTK::VersionNumber versionNumber = {}) override { return send(versionNumber, false); }
+
+    bool doWriteTransferDestructively(ChimeraTK::VersionNumber versionNumber = {}) override {
+      return send(versionNumber, true);
+    }
+
+    bool mayReplaceOther(const boost::shared_ptr<ChimeraTK::TransferElement const>&) const override { return false; }
+
+    bool isReadOnly() const override { return false; }
+
+    bool isReadable() const override { return false; }
+
+    bool isWriteable() const override { return true; }
+
+    std::vector<boost::shared_ptr<ChimeraTK::TransferElement>> getHardwareAccessingElements() override {
+      return {boost::enable_shared_from_this<ChimeraTK::TransferElement>::shared_from_this()};
+    }
+
+    void replaceTransferElement(boost::shared_ptr<ChimeraTK::TransferElement>) override {}
+
+    std::list<boost::shared_ptr<ChimeraTK::TransferElement>> getInternalElements() override { return {}; }
+
+   protected:
+    using State = detail::SPSCChannelState<UserType>;
+
+    /** Fill the given slot with the content of the user buffer */
+    void fill(typename State::Slot& slot, const VersionNumber& versionNumber, bool destructive) {
+      if(destructive) {
+        slot.buffer.swap(this->buffer_2D[0]);
+      }
+      else {
+        slot.buffer = this->buffer_2D[0]; // no allocation: the slot buffer already has the right size
+      }
+      slot.version = versionNumber;
+      slot.validity = this->_dataValidity;
+    }
+
+    bool send(const VersionNumber& versionNumber, bool destructive) {
+      auto& slots = _state->slots;
+      while(true) {
+        size_t head = _state->head.load(std::memory_order_relaxed);
+        size_t tail = _state->tail.load(std::memory_order_acquire);
+
+        // free slot available: the receiver is done with it, since it has advanced the tail past it
+        if(head - tail < slots.size()) {
+          auto& slot = slots[head % slots.size()];
+          fill(slot, versionNumber, destructive);
+          slot.state.store(State::full, std::memory_order_release);
+          _state->head.store(head + 1, std::memory_order_release);
+          _state->notifications.push();
+          return false;
+        }
+
+        // queue is full: overwrite the most recent value, unless the receiver has just started consuming it (in which
+        // case there is a free slot now and we start over)
+        auto& slot = slots[(head - 1) % slots.size()];
+        int expected = State::full;
+        if(slot.state.compare_exchange_strong(expected, State::busy, std::memory_order_acq_rel)) {
+          fill(slot, versionNumber, destructive);
+          slot.state.store(State::full, std::memory_order_release);
+          return true;
+        }
+      }
+    }
+
+    boost::shared_ptr<State> _state;
+  };
+
+  /********************************************************************************************************************/
+
+  /**
+   * Receiving end of an SPSCChannel, see createSPSCChannel(). The receiver is read-only and always has
+   * AccessMode::wait_for_new_data.
+   *
+   * A blocking read() blocks on the notification queue right away. The receiver does not spin itself: spinning before
+   * blocking is configured per module or input and done by the application accessor, see
+   * ApplicationModule::setReadSpinTime().
+   */
+  template<typename UserType>
+  class SPSCReceiver : public NDRegisterAccessor<UserType> {
+   public:
+    SPSCReceiver(boost::shared_ptr<detail::SPSCChannelState<UserType>> state, const std::string& name,
+        AccessModeFlags flags, const std::string& unit, const std::string& description)
+    : NDRegisterAccessor<UserType>(name, flags, unit, description), _state(std::move(state)) {
+      assert(flags.has(AccessMode::wait_for_new_data));
+      this->buffer_2D.resize(1);
+      this->buffer_2D[0].resize(_state->slots[0].buffer.size());
+      this->_readQueue = _state->notifications;
+    }
+
+    void doReadTransferSynchronously() override {}
+
+    void doPostRead(TransferType /*type*/, bool hasNewData) override {
+      // the only exception transported through the notification queue is the one from interrupt()
+      if(this->_activeException) _interruptPending = false;
+      if(!hasNewData) return;
+      using State = detail::SPSCChannelState<UserType>;
+      size_t tail = _state->tail.load(std::memory_order_relaxed);
+      auto& slot = _state->slots[tail % _state->slots.size()];
+
+      // the sender might be overwriting this slot right now (only if it still is the most recent one)
+      int expected = State::full;
+      while(!slot.state.compare_exchange_weak(expected, State::busy, std::memory_order_acq_rel)) {
+        expected = State::full;
+        detail::spinPause();
+      }
+      this->buffer_2D[0].swap(slot.buffer);
+      this->_versionNumber = slot.version;
+      this->_dataValidity = slot.validity;
+      slot.state.store(State::empty, std::memory_order_release);
+      _state->tail.store(tail + 1, std::memory_order_release);
+    }
+
+    bool doWriteTransfer(ChimeraTK::VersionNumber = {}) override {
+      throw ChimeraTK::logic_error("Write operation called on read-only variable " + this->getName());
+    }
+
+    bool mayReplaceOther(const boost::shared_ptr<ChimeraTK::TransferElement const>&) const override { return false; }
+
+    bool isReadOnly() const override { return true; }
+
+    bool isReadable() const override { return true; }
+
+    bool isWriteable() const override { return false; }
+
+    std::vector<boost::shared_ptr<ChimeraTK::TransferElement>> getHardwareAccessingElements() override {
+      return {boost::enable_shared_from_this<ChimeraTK::TransferElement>::shared_from_this()};
+    }
+
+    void replaceTransferElement(boost::shared_ptr<ChimeraTK::TransferElement>) override {}
+
+    std::list<boost::shared_ptr<ChimeraTK::TransferElement>> getInternalElements() override { return {}; }
+
+    /** Interrupt a blocking read. Only one interrupt is kept in the notification queue at a time, so the reserved
+     *  element is never exceeded and the number of notifications stays in sync with the number of values. */
+    void interrupt() override {
+      if(!_interruptPending.exchange(true)) TransferElement::interrupt_impl(this->_readQueue);
+    }
+
+   protected:
+    boost::shared_ptr<detail::SPSCChannelState<UserType>> _state;
+    std::atomic<bool> _interruptPending{false};
+  };
+
+  /********************************************************************************************************************/
+
+  /**
+   * Create a unidirectional single-producer/single-consumer channel. This is a lightweight replacement for the
+   * synchronised ProcessArray pair, used for push-type connections between exactly one application feeder and
+   * exactly one application consumer. The first element of the returned pair is the sender, the second the receiver.
+   *
+   * The data is transported through a ring of preallocated buffers of the given length (capacity), so no memory is
+   * allocated after the channel has been created. Writes never block, see SPSCSender. Reads block until data is
+   * available, see SPSCReceiver. The flags must contain AccessMode::wait_for_new_data.
+   */
+  template<typename UserType>
+  std::pair<boost::shared_ptr<NDRegisterAccessor<UserType>>, boost::shared_ptr<NDRegisterAccessor<UserType>>>
+      createSPSCChannel(size_t nElements, const std::string& name, const std::string& unit,
+          const std::string& description, size_t capacity, AccessModeFlags flags) {
+    if(capacity < 2) {
+      throw ChimeraTK::logic_error("SPSCChannel '" + name + "' requires a capacity of at least 2.");
+    }
+    if(!flags.has(AccessMode::wait_for_new_data)) {
+      throw ChimeraTK::logic_error("SPSCChannel '" + name + "' requires AccessMode::wait_for_new_data.");
+    }
+    auto state = boost::make_shared<detail::SPSCChannelState<UserType>>(nElements, capacity);
+    return {boost::make_shared<SPSCSender<UserType>>(state, name, flags, unit, description),
+        boost::make_shared<SPSCReceiver<UserType>>(state, name, flags, unit, description)};
+  }
+
+  /********************************************************************************************************************/
+
+} /* namespace ChimeraTK */
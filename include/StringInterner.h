@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Process-wide table of interned strings, used for the names of the hierarchy levels (path segments) while
+   * resolving the virtual hierarchy (see EntityOwner::findTag()).
+   *
+   * Each distinct string is stored exactly once and identified by a small integer ID. Module and variable names
+   * repeat a lot in large applications, so comparing and storing IDs instead of strings avoids most of the short
+   * string allocations when the hierarchy is built. Interned strings are never released, the returned references stay
+   * valid for the life time of the process.
+   *
+   * All functions are thread safe.
+   */
+  class StringInterner {
+   public:
+    using Id = uint32_t;
+
+    /** Return the ID of the given string, add it to the table if not yet present. */
+    static Id intern(std::string_view string);
+
+    /** Return the string for the given ID. The ID must have been obtained from intern(). */
+    static const std::string& get(Id id);
+
+    /** Split the given path at the slashes and append the IDs of all non-empty segments to the given vector. */
+    static void splitPath(std::string_view path, std::vector<Id>& segments);
+
+    /** IDs of the special path segments "." and "..", which are always present in the table. */
+    static constexpr Id dot{0};
+    static constexpr Id dotDot{1};
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
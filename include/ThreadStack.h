@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <boost/thread.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Helper functions to configure the stacks of the threads started by the framework and to measure their usage, see
+   * Application::setThreadStackSize().
+   *
+   * The high-water mark of a stack is measured without instrumenting the code: pages of the stack which have never
+   * been touched are not resident. Pages which are already resident when the thread starts (e.g. because the memory
+   * is locked, or because the stack is reused from a terminated thread) are filled with a pattern, so the deepest
+   * overwritten position can be found later.
+   */
+  class ThreadStack {
+   public:
+    /** Usable address range of a thread stack (excluding the guard area). The stack grows down from end. */
+    struct Bounds {
+      uintptr_t begin{0};
+      uintptr_t end{0};
+    };
+
+    /** Set the stack size and the size of the guard area of the attributes. The stack size is rounded up to a multiple
+     *  of the page size and to the minimum stack size. A stack size of 0 keeps the system default (typically 8 MiB,
+     *  see "ulimit -s"), a guard size of 0 keeps the default of one page. */
+    static void setAttributes(boost::thread::attributes& attributes, size_t stackSize, size_t guardSize);
+
+    /** Determine the stack of the calling thread. Returns false if not possible, which is the case for the main
+     *  thread, whose stack is grown on demand. */
+    static bool getCurrentBounds(Bounds& bounds);
+
+    /** Fill the resident part of the stack of the calling thread below the current stack pointer with the pattern
+     *  used by getHighWaterMark(). Non-resident pages are not touched, so this does not increase the memory usage. */
+    static void paintUnused(const Bounds& bounds);
+
+    /** Return the maximum number of bytes the thread has used so far on the given stack. The thread must still be
+     *  alive, and paintUnused() must have been called in the thread. The result is accurate to a few bytes if the
+     *  deepest position has been painted, otherwise to the page. */
+    static size_t getHighWaterMark(const Bounds& bounds);
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
@@ -95,7 +95,7 @@ namespace ChimeraTK {
   void ThreadedFanOut<UserType>::activate() {
     if(this->_disabled) return;
     assert(!_thread.joinable());
-    _thread = boost::thread([this] { this->run(); });
+    _thread = Application::createThread([this] { this->run(); });
   }
 
   /********************************************************************************************************************/
@@ -115,13 +115,14 @@ namespace ChimeraTK {
   template<typename UserType>
   void ThreadedFanOut<UserType>::run() {
     Application::registerThread("ThFO" + FanOut<UserType>::impl->getName());
+    Application::setThreadPriority(FanOut<UserType>::getHighestSlavePriority());
     Application::testableModeLock("start");
     testableModeReached = true;
 
     ChimeraTK::VersionNumber version{nullptr};
     version = readInitialValues();
     while(true) {
-      // send out copies to slaves
+      // send out copies to slaves, the slaves are ordered by priority class
       boost::this_thread::interruption_point();
       auto validity = FanOut<UserType>::impl->dataValidity();
       for(auto& slave : FanOut<UserType>::slaves) {
@@ -194,6 +195,7 @@ namespace ChimeraTK {
   template<typename UserType>
   void ThreadedFanOutWithReturn<UserType>::run() {
     Application::registerThread("ThFO" + FanOut<UserType>::impl->getName());
+    Application::setThreadPriority(FanOut<UserType>::getHighestSlavePriority());
     Application::testableModeLock("start");
     testableModeReached = true;
 
@@ -42,6 +42,11 @@ namespace ChimeraTK {
      * separate thread. */
     void run();
 
+    /** Enable detection of trigger overruns with the given policy, see Application::setTriggerOverrunPolicy(). If
+     *  statistics is not nullptr, the statistics are written to its outputs in each cycle. Must be called before
+     *  activate(). */
+    void setOverrunPolicy(TriggerOverrunPolicy policy, detail::TriggerStatistics* statistics = nullptr);
+
    protected:
     /** TransferElement acting as our trigger */
     boost::shared_ptr<ChimeraTK::TransferElement> externalTrigger;
@@ -64,6 +69,25 @@ namespace ChimeraTK {
 
     /** Reference to VariableNetwork which is being realised by this FanOut. **/
     VariableNetwork& _network;
+
+    /** Flag whether trigger overruns are detected. Only set if setOverrunPolicy() has been called. */
+    bool _detectOverruns{false};
+
+    /** Policy how to handle trigger overruns */
+    TriggerOverrunPolicy _overrunPolicy{TriggerOverrunPolicy::processAll};
+
+    /** Number of trigger overruns and skipped triggers so far */
+    uint64_t _overrunCounter{0};
+    uint64_t _skippedTriggerCounter{0};
+
+    /** Statistics about the trigger processing, see setOverrunPolicy(). Might be nullptr. */
+    detail::TriggerStatistics* _statistics{nullptr};
+
+    /** Implementations of the statistics outputs, obtained in run() once the connections have been realised. They are
+     *  written with the version number of the trigger, while the accessors would use the one of the DeviceModule. */
+    boost::shared_ptr<ChimeraTK::NDRegisterAccessor<double>> _cycleDuration;
+    boost::shared_ptr<ChimeraTK::NDRegisterAccessor<uint64_t>> _nOverruns;
+    boost::shared_ptr<ChimeraTK::NDRegisterAccessor<uint64_t>> _nSkippedTriggers;
   };
 
   /********************************************************************************************************************/
@@ -14,6 +14,7 @@
 #include <list>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 namespace ChimeraTK {
 
@@ -57,10 +58,10 @@ namespace ChimeraTK {
     void removeNodeToTrigger(const VariableNetworkNode& nodeToNoLongerTrigger);
 
     /** Check if the network already has a feeding node connected to it. */
-    bool hasFeedingNode() const;
+    bool hasFeedingNode() const { return _feeder.getType() != NodeType::invalid; }
 
     /** Count the number of consuming nodes in the network */
-    size_t countConsumingNodes() const;
+    size_t countConsumingNodes() const { return _consumers.size(); }
 
     /** Obtain the type info of the UserType. If the network type has not yet been
      * determined (i.e. if no output accessor has been assigned yet), the typeid
@@ -70,11 +71,12 @@ namespace ChimeraTK {
     /** Return the feeding node */
     VariableNetworkNode getFeedingNode() const;
 
-    /** Return list of consuming nodes */
-    std::list<VariableNetworkNode> getConsumingNodes() const;
+    /** Return list of consuming nodes, in the order they have been added to the network. The returned reference is
+     *  invalidated when nodes are added to or removed from the network. */
+    const std::vector<VariableNetworkNode>& getConsumingNodes() const { return _consumers; }
 
     /** Check whether the network has a consuming application node */
-    bool hasApplicationConsumer() const;
+    bool hasApplicationConsumer() const { return _nApplicationConsumers > 0; }
 
     /** Dump the network structure to std::cout. The optional linePrefix will be
      * prepended to all lines. */
@@ -136,8 +138,23 @@ namespace ChimeraTK {
     boost::shared_ptr<FanOutBase> getFanOut() const { return _fanOut.lock(); }
 
    protected:
-    /** List of nodes in the network */
-    std::list<VariableNetworkNode> nodeList;
+    friend class ConnectionModelCache; // restores the networks without going through addNode()
+
+    /** Add a node to the list of consumers, keeping the cached information up to date */
+    void addConsumer(const VariableNetworkNode& node, size_t position);
+
+    /** The feeding node of the network. Invalid node if the network does not (yet) have a feeder. */
+    VariableNetworkNode _feeder;
+
+    /** The consuming nodes in the network (including trigger receivers) */
+    std::vector<VariableNetworkNode> _consumers;
+
+    /** Position in _consumers at which the feeder would have been, if it was a consumer. Used to keep the order of
+     *  the nodes when the feeder is turned into a consumer, see addNode(). */
+    size_t _feederPosition{0};
+
+    /** Number of consumers with NodeType::Application */
+    size_t _nApplicationConsumers{0};
 
     /** The network value type id. Since in C++, std::type_info is non-copyable
      * and typeid() returns a reference to
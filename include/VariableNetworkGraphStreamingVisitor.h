@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "Visitor.h"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /*********************************************************************************************************************/
+
+  // Forward Declarations
+  class Application;
+  class EntityOwner;
+  class VariableNetwork;
+  class VariableNetworkNode;
+
+  /*********************************************************************************************************************/
+
+  /**
+   * Selection of the networks exported by the VariableNetworkGraphStreamingVisitor. If neither modules nor tags are
+   * given, all networks are exported.
+   */
+  struct ConnectionGraphFilter {
+    /** Export networks with an application variable owned by one of these modules (or their submodules). The modules
+     *  are specified by their qualified name, e.g. "/MyApp/Controller". */
+    std::vector<std::string> modules;
+
+    /** Export networks with an application variable carrying one of these tags. */
+    std::unordered_set<std::string> tags;
+
+    /** Additionally export networks which are up to this number of ApplicationModules away from the selected
+     *  networks. With depth 1, all connections of the modules involved in the selected networks are exported. */
+    size_t depth{0};
+  };
+
+  /*********************************************************************************************************************/
+
+  /**
+   * @brief The VariableNetworkGraphStreamingVisitor class
+   *
+   * This class provides a Graphviz dump of the VariableNetwork like the VariableNetworkGraphDumpingVisitor, but writes
+   * the graph directly to the stream while visiting the networks. Nodes are identified by short integer IDs, only the
+   * names of trigger nodes (which are shared between networks) are kept in memory. Hence it can be used for
+   * applications with a very large number of variables. The exported part of the application can be restricted with
+   * a ConnectionGraphFilter.
+   */
+  class VariableNetworkGraphStreamingVisitor : public Visitor<Application, VariableNetwork> {
+   public:
+    explicit VariableNetworkGraphStreamingVisitor(std::ostream& stream, ConnectionGraphFilter filter = {});
+    virtual ~VariableNetworkGraphStreamingVisitor() {}
+    void dispatch(const Application& t) override;
+    void dispatch(const VariableNetwork& t) override;
+
+   private:
+    /** Determine which networks pass the filter, see _selected */
+    void selectNetworks(const Application& t);
+
+    /** Return the ID of a trigger node, which is declared on top level the first time it is seen */
+    size_t getTriggerNodeId(const VariableNetworkNode& node);
+
+    /** Write the declaration of a node with the given ID */
+    void writeNode(const std::string& id, const VariableNetworkNode& node);
+
+    std::ostream& _stream;
+    ConnectionGraphFilter _filter;
+
+    /** Flag for each network (in the order of Application::networkList) whether it is exported. Empty if all networks
+     *  are exported. */
+    std::vector<bool> _selected;
+
+    /** Interned names of trigger nodes */
+    std::unordered_map<std::string, size_t> _triggerNodeIds;
+
+    size_t _networkCount{0};
+  };
+
+  /*********************************************************************************************************************/
+
+} // namespace ChimeraTK
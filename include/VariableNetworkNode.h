@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ConstantAccessor.h"
+#include "DirtyRange.h"
 #include "Flags.h"
 #include "MetaDataPropagatingRegisterDecorator.h"
 #include "Visitor.h"
@@ -14,7 +15,10 @@
 #include <boost/shared_ptr.hpp>
 
 #include <assert.h>
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <optional>
 
 namespace ChimeraTK {
 
@@ -135,14 +139,32 @@ namespace ChimeraTK {
     /** Returns true if a circular dependency has been detected and the node is a consumer. */
     bool isCircularInput() const;
 
-    /** Scan the networks and set the isCircularInput() flags if circular depencencies are detected.
-     *  Must only be called on consuming nodes.
+    /** Mark the node as input of the circular dependency network with the given ID. This sets the isCircularInput()
+     *  flag and the ID of the owning ApplicationModule. Must only be called on consuming Application-type nodes after
+     *  the connections have been made, see Application::markCircularConsumers().
      */
-    std::list<EntityOwner*> scanForCircularDepencency();
+    void setCircularNetworkHash(size_t circularNetworkHash);
 
     /** Get the unique ID of the circular network. It is 0 if the node is not part of a circular network.*/
     size_t getCircularNetworkHash() const;
 
+    /** Get the priority class of the ApplicationModule owning this node, see ApplicationModule::setPriority(). Nodes
+     *  which are not owned by an ApplicationModule (e.g. device or control system nodes) have normal priority. */
+    ModulePriority getPriority() const;
+
+    /** Set the maximum spin time before blocking in read() for this node, overriding the setting of the owning
+     *  module. See ApplicationModule::setReadSpinTime(). May only be used on Application-type nodes. */
+    void setReadSpinTime(std::chrono::nanoseconds maxSpinTime) const;
+
+    /** Get the effective maximum spin time before blocking in read(). Returns 0 (no spinning) unless this is a
+     *  consuming push-type Application node with a spin time set for the node or its owning module. Spinning is
+     *  always disabled in testable mode. */
+    std::chrono::nanoseconds getReadSpinTime() const;
+
+    /** Get the range of modified array elements, shared between the feeding application accessor and the data path.
+     *  The object is created on first use. See DirtyRange for details. */
+    std::shared_ptr<DirtyRange> getDirtyRange() const;
+
     /** Getter for the properties */
     NodeType getType() const;
     UpdateMode getMode() const;
@@ -170,6 +192,15 @@ namespace ChimeraTK {
     template<typename UserType>
     void setAppAccessorImplementation(boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> impl) const;
 
+    /** Set the implementation of an application input fed by a constant, which has been folded at connection time:
+     *  The value has already been read into the given implementation, which is used without any decorators. Folded
+     *  inputs are excluded from Module::readAll(), Module::readAnyGroup() etc. See Application::typedMakeConnection(). */
+    template<typename UserType>
+    void setAppAccessorFoldedConstant(boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> impl) const;
+
+    /** Returns true if this application input is fed by a constant which has been folded at connection time. */
+    bool isFoldedConstant() const;
+
     template<typename UserType>
     boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>> createConstAccessor(
         AccessModeFlags accessModeFlags) const;
@@ -279,6 +310,15 @@ namespace ChimeraTK {
 
     /** Hash which idientifies a circular network. 0 if the node is not part if a circular dependency. */
     size_t circularNetworkHash{0};
+
+    /** Range of modified array elements during a write (feeding nodes only, created on first use) */
+    std::shared_ptr<DirtyRange> dirtyRange;
+
+    /** Maximum spin time before blocking in read(), if set for this node. See setReadSpinTime() */
+    std::optional<std::chrono::nanoseconds> readSpinTime;
+
+    /** Flag whether this is an application input fed by a folded constant. See setAppAccessorFoldedConstant() */
+    bool foldedConstant{false};
   };
 
   /********************************************************************************************************************/
@@ -344,7 +384,10 @@ namespace ChimeraTK {
 
   template<typename UserType>
   void VariableNetworkNode::setAppAccessorImplementation(boost::shared_ptr<NDRegisterAccessor<UserType>> impl) const {
-    auto decorated = boost::make_shared<MetaDataPropagatingRegisterDecorator<UserType>>(impl, getOwningModule());
+    // all application-side features are handled by a single decorator, see MetaDataPropagatingRegisterDecorator
+    auto decorated =
+        boost::make_shared<MetaDataPropagatingRegisterDecorator<UserType>>(impl, getOwningModule(), getReadSpinTime());
+    decorated->_qualifiedName = getQualifiedName();
     getAppAccessor<UserType>().replace(decorated);
     auto flagProvider = boost::dynamic_pointer_cast<MetaDataPropagationFlagProvider>(decorated);
     assert(flagProvider);
@@ -352,4 +395,13 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  template<typename UserType>
+  void VariableNetworkNode::setAppAccessorFoldedConstant(boost::shared_ptr<NDRegisterAccessor<UserType>> impl) const {
+    assert(getType() == NodeType::Application && getDirection().dir == VariableDirection::consuming);
+    getAppAccessor<UserType>().replace(impl);
+    pdata->foldedConstant = true;
+  }
+
+  /********************************************************************************************************************/
+
 } /* namespace ChimeraTK */
@@ -3,12 +3,12 @@
 #pragma once
 
 #include "Module.h"
-
-#include <ChimeraTK/RegisterPath.h>
+#include "StringInterner.h"
 
 #include <boost/thread.hpp>
 
 #include <list>
+#include <unordered_map>
 
 namespace ChimeraTK {
 
@@ -45,12 +45,15 @@ namespace ChimeraTK {
     void removeSubModule(const std::string& name);
 
     /** Return the submodule with the given name. If it doesn't exist, create it
-     * first. */
-    VirtualModule& createAndGetSubmodule(const RegisterPath& moduleName);
+     * first. A leading slash in the name is ignored. */
+    VirtualModule& createAndGetSubmodule(const std::string& moduleName);
+
+    /** Like createAndGetSubmodule(), but with the interned name of the submodule (see StringInterner). */
+    VirtualModule& createAndGetSubmodule(StringInterner::Id moduleName);
 
     /** Like createAndGetSubmodule(), but recursively create a hierarchy of
      * submodules separated by "/" in the moduleName. */
-    VirtualModule& createAndGetSubmoduleRecursive(const RegisterPath& moduleName);
+    VirtualModule& createAndGetSubmoduleRecursive(const std::string& moduleName);
 
     ModuleType getModuleType() const override { return _moduleType; }
 
@@ -61,6 +64,9 @@ namespace ChimeraTK {
    protected:
     std::list<VirtualModule> submodules;
     ModuleType _moduleType;
+
+    /** Index of the submodules by their interned names, to avoid comparing strings in createAndGetSubmodule() */
+    std::unordered_map<StringInterner::Id, VirtualModule*> submoduleIndex;
   };
 
 } /* namespace ChimeraTK */
@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "AdaptiveSpinWait.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  namespace {
+    /** Weight of a new sample in the moving averages */
+    constexpr double averagingWeight = 1. / 8.;
+
+    /** Minimum tolerance added to the expected arrival time, to cover the jitter of perfectly regular updates */
+    constexpr std::chrono::nanoseconds minimumSlack{std::chrono::microseconds(1)};
+  } // namespace
+
+  /********************************************************************************************************************/
+
+  bool AdaptiveSpinWait::getDeadline(Clock::time_point& deadline) const {
+    // no estimate yet
+    if(_nArrivals < 2) return false;
+
+    auto now = Clock::now();
+    auto expected = _lastArrival + std::chrono::nanoseconds(int64_t(_meanInterval));
+    deadline = expected + std::max(std::chrono::nanoseconds(int64_t(2 * _meanDeviation)), minimumSlack);
+
+    // Data is overdue (beyond the typical jitter) or not expected within the spin budget: block right away
+    if(deadline <= now || expected - now > _maxSpinTime) return false;
+    deadline = std::min(deadline, now + _maxSpinTime);
+    return true;
+  }
+
+  /********************************************************************************************************************/
+
+  void AdaptiveSpinWait::arrived() {
+    auto now = Clock::now();
+    if(_nArrivals > 0) {
+      double interval = double(std::chrono::duration_cast<std::chrono::nanoseconds>(now - _lastArrival).count());
+      if(_nArrivals == 1) {
+        _meanInterval = interval;
+      }
+      else {
+        _meanDeviation += averagingWeight * (std::abs(interval - _meanInterval) - _meanDeviation);
+        _meanInterval += averagingWeight * (interval - _meanInterval);
+      }
+    }
+    _lastArrival = now;
+    ++_nArrivals;
+  }
+
+  /********************************************************************************************************************/
+
+  std::chrono::nanoseconds AdaptiveSpinWait::getTypicalInterval() const {
+    return std::chrono::nanoseconds(int64_t(_meanInterval));
+  }
+
+  /********************************************************************************************************************/
+
+} /* namespace ChimeraTK */
@@ -4,16 +4,22 @@
 
 #include "ApplicationModule.h"
 #include "ArrayAccessor.h"
+#include "ConnectionModelCache.h"
 #include "ConstantAccessor.h"
 #include "ConsumingFanOut.h"
 #include "DebugPrintAccessorDecorator.h"
 #include "DeviceModule.h"
 #include "ExceptionHandlingDecorator.h"
 #include "FeedingFanOut.h"
+#include "IntrospectionServer.h"
+#include "MemoryLocking.h"
 #include "ScalarAccessor.h"
+#include "SPSCChannel.h"
 #include "TestableModeAccessorDecorator.h"
 #include "ThreadedFanOut.h"
+#include "ThreadStack.h"
 #include "TriggerFanOut.h"
+#include "VariableGroup.h"
 #include "VariableNetworkGraphDumpingVisitor.h"
 #include "VariableNetworkModuleGraphDumpingVisitor.h"
 #include "VariableNetworkNode.h"
@@ -23,12 +29,22 @@
 
 #include <ChimeraTK/BackendFactory.h>
 
+#include <boost/container_hash/hash.hpp>
+#include <boost/dynamic_bitset.hpp>
 #include <boost/fusion/container/map.hpp>
 
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <cstring>
 #include <exception>
 #include <fstream>
+#include <functional>
+#include <limits>
 #include <string>
 #include <thread>
+#include <unordered_map>
 
 using namespace ChimeraTK;
 
@@ -69,6 +85,16 @@ void Application::enableTestableMode() {
 
 /*********************************************************************************************************************/
 
+void Application::setTriggerOverrunPolicy(
+    const VariableNetworkNode& trigger, TriggerOverrunPolicy policy, const std::string& statisticsPath) {
+  if(initialiseCalled) {
+    throw ChimeraTK::logic_error("Application::setTriggerOverrunPolicy() must be called before initialise().");
+  }
+  triggerOverrunSettings[trigger] = {policy, statisticsPath, false};
+}
+
+/*********************************************************************************************************************/
+
 bool Application::testableModeTestLock() {
   if(!getInstance().testableMode) return false;
   return getTestableModeLockObject().owns_lock();
@@ -76,13 +102,124 @@ bool Application::testableModeTestLock() {
 
 /*********************************************************************************************************************/
 
+namespace {
+  /** Invalidates the stack bounds of the thread status when the thread terminates, before the stack is released */
+  struct ThreadStackRelease {
+    ~ThreadStackRelease() {
+      if(!status) return;
+      std::unique_lock<std::mutex> lock(status->stackMutex);
+      status->stack = {};
+    }
+    std::shared_ptr<detail::ThreadStatus> status;
+  };
+  thread_local ThreadStackRelease threadStackRelease;
+} // namespace
+
+/*********************************************************************************************************************/
+
 void Application::registerThread(const std::string& name) {
   Application::getInstance().setThreadName(name);
+  detail::currentThreadStatus = std::make_shared<detail::ThreadStatus>(name);
+  if(ThreadStack::getCurrentBounds(detail::currentThreadStatus->stack)) {
+    ThreadStack::paintUnused(detail::currentThreadStatus->stack);
+    threadStackRelease.status = detail::currentThreadStatus;
+  }
+  {
+    auto& app = Application::getInstance();
+    std::unique_lock<std::mutex> myLock(app.m_threadNames);
+    app.threadStatusList.remove_if([](auto& status) { return status.expired(); });
+    app.threadStatusList.push_back(detail::currentThreadStatus);
+  }
   pthread_setname_np(pthread_self(), name.substr(0, std::min<std::string::size_type>(name.length(), 15)).c_str());
 }
 
 /*********************************************************************************************************************/
 
+boost::thread Application::createThread(std::function<void()> function, size_t stackSize) {
+  auto& app = Application::getInstance();
+  boost::thread::attributes attributes;
+  ThreadStack::setAttributes(attributes, stackSize > 0 ? stackSize : app.threadStackSize, app.threadStackGuardSize);
+  return boost::thread(attributes, std::move(function));
+}
+
+/*********************************************************************************************************************/
+
+void Application::setThreadStackSize(size_t stackSize, size_t guardSize) {
+  if(runCalled) {
+    throw ChimeraTK::logic_error("Application::setThreadStackSize() must be called before the application is started.");
+  }
+  threadStackSize = stackSize;
+  threadStackGuardSize = guardSize;
+}
+
+/*********************************************************************************************************************/
+
+std::list<std::shared_ptr<detail::ThreadStatus>> Application::getThreadStatusList() {
+  std::list<std::shared_ptr<detail::ThreadStatus>> threads;
+  std::unique_lock<std::mutex> lock(m_threadNames);
+  for(auto it = threadStatusList.begin(); it != threadStatusList.end();) {
+    auto status = it->lock();
+    if(!status) {
+      it = threadStatusList.erase(it);
+      continue;
+    }
+    threads.push_back(std::move(status));
+    ++it;
+  }
+  return threads;
+}
+
+/*********************************************************************************************************************/
+
+std::vector<Application::ThreadStackUsage> Application::getThreadStackUsage() {
+  std::vector<ThreadStackUsage> usage;
+  for(auto& thread : getThreadStatusList()) {
+    std::unique_lock<std::mutex> lock(thread->stackMutex);
+    if(thread->stack.end == 0) continue;
+    auto highWaterMark = ThreadStack::getHighWaterMark(thread->stack);
+    usage.push_back({thread->name, thread->stack.end - thread->stack.begin, highWaterMark});
+  }
+  return usage;
+}
+
+/*********************************************************************************************************************/
+
+void Application::setThreadPriority(ModulePriority priority) {
+  // Real-time priorities of the SCHED_FIFO classes. Both are kept below the default priority of the kernel threads
+  // handling interrupts (50), so device drivers are not starved by busy control loops.
+  constexpr int highPriority = 10;
+  constexpr int realtimePriority = 40;
+
+  int policy;
+  sched_param param{};
+  switch(priority) {
+    case ModulePriority::normal:
+      return;
+    case ModulePriority::low:
+      policy = SCHED_BATCH;
+      param.sched_priority = 0;
+      break;
+    case ModulePriority::high:
+      policy = SCHED_FIFO;
+      param.sched_priority = highPriority;
+      break;
+    case ModulePriority::realtime:
+      policy = SCHED_FIFO;
+      param.sched_priority = realtimePriority;
+      break;
+    default:
+      throw ChimeraTK::logic_error("Application::setThreadPriority(): Unknown priority class.");
+  }
+
+  int ret = pthread_setschedparam(pthread_self(), policy, &param);
+  if(ret != 0) {
+    std::cerr << "*** Warning: Cannot change the scheduling policy of thread '" << threadName()
+              << "': " << std::strerror(ret) << ". Continuing with the default policy." << std::endl;
+  }
+}
+
+/*********************************************************************************************************************/
+
 void Application::incrementDataLossCounter(const std::string& name) {
   if(getInstance().debugDataLoss) {
     std::cout << "Data loss in variable " << name << std::endl;
@@ -107,27 +244,19 @@ void Application::initialise() {
     throw ChimeraTK::logic_error("Application::initialise() was already called before.");
   }
 
-  // call the user-defined defineConnections() function which describes the structure of the application
-  defineConnections();
-  for(auto& module : getSubmoduleListRecursive()) {
-    module->defineConnections();
+  // restore the connection model from the cache, if enabled and matching the executable and the module tree
+  if(!connectionModelCacheFile.empty() && ConnectionModelCache(*this, connectionModelCacheFile).restore()) {
+    // only the implementations need to be created
+    realiseConnections();
   }
+  else {
+    defineConnectionModel();
 
-  // call defineConnections() for alldevice modules
-  for(auto& devModule : deviceModuleMap) {
-    devModule.second->defineConnections();
+    // realise the connections between variable accessors as described in the
+    // initialise() function
+    makeConnections();
   }
 
-  // find and handle constant nodes
-  findConstantNodes();
-
-  // connect any unconnected accessors with constant values
-  processUnconnectedNodes();
-
-  // realise the connections between variable accessors as described in the
-  // initialise() function
-  makeConnections();
-
   // set flag to prevent further calls to this function and to prevent definition of additional connections.
   initialiseCalled = true;
 }
@@ -148,7 +277,8 @@ void Application::optimiseUnmappedVariables(const std::set<std::string>& names)
           using UserType = decltype(t);
 
           // replace comsuming node with constant in the model
-          network.removeNode(network.getConsumingNodes().front());
+          auto consumer = network.getConsumingNodes().front();
+          network.removeNode(consumer);
           auto constNode = VariableNetworkNode::makeConstant<UserType>(
               false, UserType(), network.getFeedingNode().getNumberOfElements());
           network.addNode(constNode);
@@ -281,21 +411,33 @@ void Application::run() {
     deviceModule.second->prepare();
   }
 
+  // Lock the memory before any thread is started, so the buffers allocated so far are faulted in now
+  if(memoryLocking && !testableMode) {
+    lockMemory();
+  }
+
   // Switch life-cycle state to run
   lifeCycleState = LifeCycleState::run;
 
-  // start the necessary threads for the FanOuts etc.
-  for(auto& internalModule : internalModuleList) {
-    internalModule->activate();
-  }
+  try {
+    // start the necessary threads for the FanOuts etc.
+    for(auto& internalModule : internalModuleList) {
+      internalModule->activate();
+    }
 
-  for(auto& deviceModule : deviceModuleMap) {
-    deviceModule.second->run();
-  }
+    for(auto& deviceModule : deviceModuleMap) {
+      deviceModule.second->run();
+    }
 
-  // start the threads for the modules
-  for(auto& module : getSubmoduleListRecursive()) {
-    module->run();
+    // start the threads for the modules
+    for(auto& module : getSubmoduleListRecursive()) {
+      module->run();
+    }
+  }
+  catch(boost::thread_resource_error& e) {
+    throw ChimeraTK::runtime_error(std::string("Application::run(): Cannot start thread: ") + e.what() +
+        ". Check the limits for the number of threads and the locked memory (RLIMIT_NPROC, RLIMIT_MEMLOCK) or reduce "
+        "the stack size with setThreadStackSize().");
   }
 
   // When in testable mode, wait for all modules to report that they have reched the testable mode.
@@ -325,6 +467,141 @@ void Application::run() {
 
   // Launch circular dependency detector thread
   circularDependencyDetector.startDetectBlockedModules();
+
+  // Launch the introspection server, if requested
+  if(!introspectionSocketPath.empty()) {
+    try {
+      introspectionServer = std::make_shared<IntrospectionServer>(*this, introspectionSocketPath);
+    }
+    catch(ChimeraTK::runtime_error& e) {
+      std::cerr << "Cannot create introspection socket: " << e.what() << std::endl;
+    }
+  }
+
+  // All threads are running now, so future memory can be locked without faulting in the complete thread stacks
+  if(memoryLocking && !testableMode) {
+    lockMemoryOnFault();
+  }
+}
+
+/*********************************************************************************************************************/
+
+void Application::enableConnectionModelCache(const std::string& fileName, const std::string& modelVersion) {
+  if(initialiseCalled) {
+    throw ChimeraTK::logic_error("Application::enableConnectionModelCache() must be called before the application is "
+                                 "initialised.");
+  }
+  connectionModelCacheFile = fileName;
+  connectionModelVersion = modelVersion;
+}
+
+/*********************************************************************************************************************/
+
+void Application::enableIntrospectionSocket(const std::string& socketPath) {
+  if(runCalled) {
+    throw ChimeraTK::logic_error("Application::enableIntrospectionSocket() must be called before the application is "
+                                 "started.");
+  }
+  introspectionSocketPath = socketPath;
+}
+
+/*********************************************************************************************************************/
+
+void Application::enableMemoryLocking(bool useHugePages) {
+  if(runCalled) {
+    throw ChimeraTK::logic_error("Application::enableMemoryLocking() must be called before the application is "
+                                 "started.");
+  }
+  memoryLocking = true;
+  memoryLockingHugePages = useHugePages;
+}
+
+/*********************************************************************************************************************/
+
+void Application::enableOrderedInitialValues(std::chrono::milliseconds maxWait) {
+  if(runCalled) {
+    throw ChimeraTK::logic_error("Application::enableOrderedInitialValues() must be called before the application is "
+                                 "started.");
+  }
+  if(maxWait.count() <= 0) {
+    throw ChimeraTK::logic_error("Application::enableOrderedInitialValues(): maxWait must be positive.");
+  }
+  orderedInitialValuesMaxWait = maxWait;
+}
+
+/*********************************************************************************************************************/
+
+void Application::notifyInitialValuePublished() {
+  if(orderedInitialValuesMaxWait.count() == 0) return;
+  boost::lock_guard<boost::mutex> lock(orderedInitialValuesMutex);
+  orderedInitialValuesCondition.notify_all();
+}
+
+/*********************************************************************************************************************/
+
+bool Application::waitForUpstreamInitialValue(
+    const VariableNetworkNode& consumer, boost::chrono::steady_clock::time_point deadline) {
+  if(orderedInitialValuesMaxWait.count() == 0) return false;
+
+  // Only inputs fed by other ApplicationModules are ordered. Inputs in circular networks must not wait, since the
+  // upstream module might wait for us.
+  const auto& feeder = consumer.getOwner().getFeedingNode();
+  if(feeder.getType() != NodeType::Application || consumer.getCircularNetworkHash() != 0) return false;
+  auto* consumingModule = dynamic_cast<Module*>(consumer.getOwningModule())->findApplicationModule();
+  auto* feedingModule = dynamic_cast<Module*>(feeder.getOwningModule())->findApplicationModule();
+  if(consumingModule == feedingModule) return false;
+  auto flagProvider = boost::dynamic_pointer_cast<MetaDataPropagationFlagProvider>(
+      feeder.getAppAccessorNoType().getHighLevelImplElement());
+  if(!flagProvider) return false;
+
+  boost::unique_lock<boost::mutex> lock(orderedInitialValuesMutex);
+  if(!orderedInitialValuesCondition.wait_until(
+         lock, deadline, [&] { return flagProvider->hasPublishedInitialValue(); })) {
+    std::cerr << "*** Warning: " << feedingModule->getQualifiedName() << " did not write '"
+              << feeder.getQualifiedName() << "' in its mainLoop() within the " << orderedInitialValuesMaxWait.count()
+              << " ms granted for the initial values of " << consumingModule->getQualifiedName()
+              << ". It continues with the first value." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/*********************************************************************************************************************/
+
+void Application::lockMemory() {
+  if(memoryLockingHugePages) {
+    auto hugePageSize = MemoryLocking::getHugePageSize();
+    if(hugePageSize == 0) {
+      std::cerr << "*** Warning: Transparent huge pages are not available, using normal pages." << std::endl;
+    }
+    else {
+      std::ifstream maps("/proc/self/maps");
+      auto regions = MemoryLocking::findLargeAnonymousRegions(maps, hugePageSize);
+      auto advised = MemoryLocking::adviseHugePages(regions, hugePageSize);
+      if(enableDebugMakeConnections) {
+        std::cout << "Using huge pages for " << advised / (1024 * 1024) << " MiB in " << regions.size()
+                  << " memory regions." << std::endl;
+      }
+    }
+  }
+
+  // Only the current memory is locked here. Locking future memory now would fault in and lock the complete stacks of
+  // all threads started next, which also makes the thread creation fail once RLIMIT_MEMLOCK is exceeded.
+  std::string error;
+  if(!MemoryLocking::lockCurrent(error)) {
+    std::cerr << "*** Warning: Cannot lock the memory of the application: " << error
+              << ". Page faults may occur while running (check RLIMIT_MEMLOCK)." << std::endl;
+  }
+}
+
+/*********************************************************************************************************************/
+
+void Application::lockMemoryOnFault() {
+  std::string error;
+  if(!MemoryLocking::lockOnFault(error)) {
+    std::cerr << "*** Warning: Cannot lock the memory of the application on fault: " << error
+              << ". Page faults may occur while running (check RLIMIT_MEMLOCK)." << std::endl;
+  }
 }
 
 /*********************************************************************************************************************/
@@ -333,6 +610,9 @@ void Application::shutdown() {
   // switch life-cycle state
   lifeCycleState = LifeCycleState::shutdown;
 
+  // stop the introspection server first, as it accesses the accessors and modules
+  introspectionServer.reset();
+
   // first allow to run the application threads again, if we are in testable
   // mode
   if(testableMode && testableModeTestLock()) {
@@ -361,16 +641,14 @@ void Application::shutdown() {
 }
 /*********************************************************************************************************************/
 
-void Application::generateXML() {
-  assert(applicationName != "");
-
-  // define the connections
+void Application::defineConnectionModel() {
+  // call the user-defined defineConnections() function which describes the structure of the application
   defineConnections();
   for(auto& module : getSubmoduleListRecursive()) {
     module->defineConnections();
   }
 
-  // create connections for exception handling
+  // call defineConnections() for all device modules
   for(auto& devModule : deviceModuleMap) {
     devModule.second->defineConnections();
   }
@@ -378,9 +656,16 @@ void Application::generateXML() {
   // find and handle constant nodes
   findConstantNodes();
 
-  // also search for unconnected nodes - this is here only executed to print the
-  // warnings
+  // connect any unconnected accessors with constant values
   processUnconnectedNodes();
+}
+
+/*********************************************************************************************************************/
+
+void Application::generateXML() {
+  assert(applicationName != "");
+
+  defineConnectionModel();
 
   // finalise connections: decide still-undecided details, in particular for
   // control-system and device varibales, which get created "on the fly".
@@ -393,6 +678,24 @@ void Application::generateXML() {
 
 /*********************************************************************************************************************/
 
+void Application::validateConnections() {
+  if(initialiseCalled) {
+    throw ChimeraTK::logic_error("Application::validateConnections() cannot be called after initialise().");
+  }
+
+  defineConnectionModel();
+
+  // same steps as in makeConnections(), just without realising the connections
+  finaliseNetworks();
+  optimiseConnections();
+  checkConnections();
+
+  // the model cannot be defined a second time
+  initialiseCalled = true;
+}
+
+/*********************************************************************************************************************/
+
 VariableNetwork& Application::connect(VariableNetworkNode a, VariableNetworkNode b) {
   // if one of the nodes has the value type AnyType, set it to the type of the
   // other if both are AnyType, nothing changes.
@@ -618,7 +921,12 @@ std::pair<boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>,
       pvarPair;
   if(consumer.getType() != NodeType::invalid)
     assert(node.getDirection().withReturn == consumer.getDirection().withReturn);
-  if(!node.getDirection().withReturn) {
+  if(!node.getDirection().withReturn && flags.has(AccessMode::wait_for_new_data) &&
+      node.getType() == NodeType::Application && consumer.getType() == NodeType::Application) {
+    // 1:1 push-type connection between two application modules: use the lightweight SPSC channel
+    pvarPair = createSPSCChannel<UserType>(nElements, name, node.getUnit(), node.getDescription(), 3, flags);
+  }
+  else if(!node.getDirection().withReturn) {
     pvarPair =
         createSynchronizedProcessArray<UserType>(nElements, name, node.getUnit(), node.getDescription(), {}, 3, flags);
   }
@@ -695,19 +1003,56 @@ void Application::makeConnections() {
   // run checks
   checkConnections();
 
+  // store the final connection model, so the next start can skip everything above
+  if(!connectionModelCacheFile.empty()) {
+    ConnectionModelCache(*this, connectionModelCacheFile).save();
+  }
+
+  realiseConnections();
+}
+
+/*********************************************************************************************************************/
+
+void Application::realiseConnections() {
   // make the connections for all networks
   for(auto& network : networkList) {
     makeConnectionsForNetwork(network);
   }
 
+  // an overrun policy which is not applied to any TriggerFanOut is most likely set for the wrong node
+  for(auto& settings : triggerOverrunSettings) {
+    if(!settings.second.used) {
+      throw ChimeraTK::logic_error("Application::setTriggerOverrunPolicy() was called for '" +
+          settings.first.getQualifiedName() + "', which does not trigger reading any device register.");
+    }
+  }
+
   // check for circular dependencies
-  for(auto& network : networkList) {
-    markCircularConsumers(network);
+  markCircularConsumers();
+
+  if(enableDebugMakeConnections) {
+    std::cout << "Folded " << nFoldedConstants << " application inputs fed by constants." << std::endl;
   }
 }
 
 /*********************************************************************************************************************/
 
+bool Application::isFoldableConstantConsumer(const VariableNetworkNode& consumer) const {
+  if(testableMode || consumer.getType() != NodeType::Application) return false;
+  if(consumer.getMode() == UpdateMode::poll) return true;
+
+  // Look for another push-type input of the same module (or VariableGroup) which is not fed by a constant
+  for(auto& accessor : consumer.getOwningModule()->getAccessorListRecursive()) {
+    if(accessor == consumer || accessor.getMode() != UpdateMode::push) continue;
+    if(accessor.getDirection().dir != VariableDirection::consuming) continue;
+    if(!accessor.hasOwner() || !accessor.getOwner().hasFeedingNode()) continue;
+    if(accessor.getOwner().getFeedingNode().getType() != NodeType::Constant) return true;
+  }
+  return false;
+}
+
+/*********************************************************************************************************************/
+
 void Application::findConstantNodes() {
   for(auto& module : getSubmoduleListRecursive()) {
     for(auto& accessor : module->getAccessorList()) {
@@ -797,6 +1142,47 @@ void Application::finaliseNetworks() {
       }
     }
   }
+
+  // publish the statistics of the TriggerFanOuts which remain after the above
+  defineTriggerStatistics();
+}
+
+/*********************************************************************************************************************/
+
+void Application::defineTriggerStatistics() {
+  // collect the devices read by a TriggerFanOut with statistics first, since connecting adds to the networkList
+  std::vector<std::pair<TriggerOverrunSettings*, std::string>> fanOuts;
+  for(auto& network : networkList) {
+    if(network.getTriggerType() != VariableNetwork::TriggerType::external) continue;
+    auto feeder = network.getFeedingNode();
+    if(feeder.getType() != NodeType::Device) continue;
+    auto settings = triggerOverrunSettings.find(feeder.getExternalTrigger());
+    if(settings == triggerOverrunSettings.end() || settings->second.statisticsPath.empty()) continue;
+    if(settings->second.statistics.count(feeder.getDeviceAlias())) continue;
+    settings->second.statistics[feeder.getDeviceAlias()] = nullptr;
+    fanOuts.emplace_back(&settings->second, feeder.getDeviceAlias());
+  }
+
+  for(auto& [settings, deviceAlias] : fanOuts) {
+    assert(deviceModuleMap.find(deviceAlias) != deviceModuleMap.end());
+    auto& deviceModule = *deviceModuleMap[deviceAlias];
+    auto& statistics = deviceModule.triggerStatistics.emplace_back(
+        &deviceModule, "TriggerStatistics" + std::to_string(deviceModule.triggerStatistics.size()));
+    settings->statistics[deviceAlias] = &statistics;
+
+    // the ControlSystemModule accepts only a single hierarchy level at a time
+    std::string alias = deviceAlias;
+    std::replace(alias.begin(), alias.end(), '/', '_');
+    ControlSystemModule cs;
+    const Module* directory = &cs;
+    for(auto& component : RegisterPath(settings->statisticsPath).getComponents()) {
+      directory = &(*directory)[component];
+    }
+    directory = &(*directory)[alias];
+    statistics.cycleDuration >> (*directory)("cycleDuration");
+    statistics.nOverruns >> (*directory)("nOverruns");
+    statistics.nSkippedTriggers >> (*directory)("nSkippedTriggers");
+  }
 }
 
 /*********************************************************************************************************************/
@@ -845,7 +1231,7 @@ void Application::optimiseConnections() {
       // will merge the network of the outer loop into the network of the inner
       // loop, since the network of the outer loop will not be found a second
       // time in the inner loop.
-      for(auto& consumer : it1->getConsumingNodes()) {
+      for(auto consumer : it1->getConsumingNodes()) {
         consumer.clearOwner();
         it2->addNode(consumer);
       }
@@ -897,6 +1283,13 @@ void Application::dumpConnectionGraph(const std::string& fileName) {
 
 /*********************************************************************************************************************/
 
+void Application::dumpConnectionGraph(std::ostream& stream, const ConnectionGraphFilter& filter) const {
+  VariableNetworkGraphStreamingVisitor visitor{stream, filter};
+  visitor.dispatch(*this);
+}
+
+/*********************************************************************************************************************/
+
 void Application::dumpModuleConnectionGraph(const std::string& fileName) const {
   std::fstream file{fileName, std::ios_base::out};
 
@@ -941,18 +1334,112 @@ void Application::makeConnectionsForNetwork(VariableNetwork& network) {
 
 /*********************************************************************************************************************/
 
-void Application::markCircularConsumers(VariableNetwork& variableNetwork) {
-  for(auto& node : variableNetwork.getConsumingNodes()) {
-    // A variable network is a tree-like network of VariableNetworkNodes (one feeder and one or more multiple consumers)
-    // A circlular network is a list of modules (EntityOwners) which have a circular dependency
-    auto circularNetwork = node.scanForCircularDepencency();
-    if(circularNetwork.size() > 0) {
-      auto circularNetworkHash = boost::hash_range(circularNetwork.begin(), circularNetwork.end());
-      circularDependencyNetworks[circularNetworkHash] = circularNetwork;
-      circularNetworkInvalidityCounters[circularNetworkHash] = 0;
+void Application::markCircularConsumers() {
+  // Build the module-level dependency graph once. Each ApplicationModule involved in an application-to-application
+  // connection gets an integer ID, and for each module the IDs of the modules feeding its inputs are stored. Nodes of
+  // the control system, devices and constants have no owning ApplicationModule and hence stop any circle.
+  constexpr size_t noModule = std::numeric_limits<size_t>::max();
+  std::vector<EntityOwner*> modules;
+  std::unordered_map<EntityOwner*, size_t> moduleIds;
+  auto getModuleId = [&](const VariableNetworkNode& node) {
+    auto owningModule = node.getOwningModule();
+    if(!owningModule) return noModule;
+    // if the entity owner is a variable group we must go up the hierarchy until we find the application module
+    while(owningModule->getModuleType() == EntityOwner::ModuleType::VariableGroup) {
+      owningModule = static_cast<VariableGroup*>(owningModule)->getOwner();
+    }
+    if(owningModule->getModuleType() != EntityOwner::ModuleType::ApplicationModule) return noModule;
+    auto [it, inserted] = moduleIds.try_emplace(owningModule, modules.size());
+    if(inserted) modules.push_back(owningModule);
+    return it->second;
+  };
+
+  struct Input {
+    VariableNetworkNode node;
+    size_t module;
+    size_t feedingModule;
+  };
+  std::vector<Input> inputs;
+  for(auto& network : networkList) {
+    if(!network.hasFeedingNode()) continue;
+    auto feedingModule = getModuleId(network.getFeedingNode());
+    if(feedingModule == noModule) continue;
+    for(auto& consumer : network.getConsumingNodes()) {
+      auto module = getModuleId(consumer);
+      if(module == noModule) continue;
+      inputs.push_back({consumer, module, feedingModule});
+    }
+  }
+
+  size_t nModules = modules.size();
+  std::vector<std::vector<size_t>> feedingModules(nModules);
+  for(auto& input : inputs) feedingModules[input.module].push_back(input.feedingModule);
+
+  // Find the strongly connected components along the inputs (Tarjan's algorithm). An input is part of a circle if its
+  // module and the module feeding it are in the same component (this includes a module feeding itself).
+  std::vector<size_t> index(nModules, noModule), lowLink(nModules), component(nModules);
+  std::vector<bool> onStack(nModules, false);
+  std::vector<size_t> stack;
+  size_t nextIndex = 0, nComponents = 0;
+  std::function<void(size_t)> strongConnect = [&](size_t v) {
+    index[v] = lowLink[v] = nextIndex++;
+    stack.push_back(v);
+    onStack[v] = true;
+    for(auto w : feedingModules[v]) {
+      if(index[w] == noModule) {
+        strongConnect(w);
+        lowLink[v] = std::min(lowLink[v], lowLink[w]);
+      }
+      else if(onStack[w]) {
+        lowLink[v] = std::min(lowLink[v], index[w]);
+      }
     }
+    if(lowLink[v] == index[v]) {
+      size_t w;
+      do {
+        w = stack.back();
+        stack.pop_back();
+        onStack[w] = false;
+        component[w] = nComponents;
+      } while(w != v);
+      ++nComponents;
+    }
+  };
+  for(size_t v = 0; v < nModules; ++v) {
+    if(index[v] == noModule) strongConnect(v);
+  }
+
+  // The circular network of a component consists of all modules from which the component can be reached through
+  // inputs, i.e. the component itself and all modules upstream of it. It is collected once per component.
+  std::unordered_map<size_t, size_t> componentHashes;
+  for(auto& input : inputs) {
+    if(component[input.module] != component[input.feedingModule]) continue;
+    auto [it, inserted] = componentHashes.try_emplace(component[input.module], 0);
+    if(inserted) {
+      boost::dynamic_bitset<> upstream(nModules);
+      upstream.set(input.module);
+      std::vector<size_t> toVisit{input.module};
+      while(!toVisit.empty()) {
+        auto v = toVisit.back();
+        toVisit.pop_back();
+        for(auto w : feedingModules[v]) {
+          if(!upstream.test_set(w)) toVisit.push_back(w);
+        }
+      }
+      // The hash serves as unique ID of the network, so it is computed from the module pointers in ascending order.
+      std::list<EntityOwner*> circularNetwork;
+      for(auto i = upstream.find_first(); i != upstream.npos; i = upstream.find_next(i)) {
+        circularNetwork.push_back(modules[i]);
+      }
+      circularNetwork.sort();
+      it->second = boost::hash_range(circularNetwork.begin(), circularNetwork.end());
+      circularDependencyNetworks[it->second] = std::move(circularNetwork);
+      circularNetworkInvalidityCounters[it->second] = 0;
+    }
+    input.node.setCircularNetworkHash(it->second);
   }
 }
+
 /*********************************************************************************************************************/
 
 template<typename UserType>
@@ -1062,6 +1549,16 @@ void Application::typedMakeConnection(VariableNetwork& network) {
                 network.getExternalTriggerImpl(), *deviceModuleMap[feeder.getDeviceAlias()], network);
             triggerMap[triggerImplId] = triggerFanOut;
             internalModuleList.push_back(triggerFanOut);
+
+            // configure overrun handling, if requested for this trigger
+            auto settings = triggerOverrunSettings.find(feeder.getExternalTrigger());
+            if(settings != triggerOverrunSettings.end()) {
+              // one TriggerFanOut exists per trigger and device, so the statistics have been defined per device
+              auto statistics = settings->second.statistics.find(feeder.getDeviceAlias());
+              triggerFanOut->setOverrunPolicy(settings->second.policy,
+                  statistics != settings->second.statistics.end() ? statistics->second : nullptr);
+              settings->second.used = true;
+            }
           }
           fanOut = triggerFanOut->addNetwork(feedingImpl, consumerImplementationPairs);
           network.setFanOut(fanOut);
@@ -1159,6 +1656,7 @@ void Application::typedMakeConnection(VariableNetwork& network) {
         auto fanOut =
             boost::make_shared<FeedingFanOut<UserType>>(feeder.getName(), feeder.getUnit(), feeder.getDescription(),
                 feeder.getNumberOfElements(), feeder.getDirection().withReturn, consumerImplementationPairs);
+        fanOut->setDirtyRange(feeder.getDirtyRange());
         feeder.setAppAccessorImplementation<UserType>(fanOut);
         network.setFanOut(fanOut);
 
@@ -1182,7 +1680,17 @@ void Application::typedMakeConnection(VariableNetwork& network) {
         auto feedingImpl = feeder.createConstAccessor<UserType>(flags);
 
         if(consumer.getType() == NodeType::Application) {
-          if(testableMode && consumer.getMode() == UpdateMode::push) {
+          if(isFoldableConstantConsumer(consumer)) {
+            // Obtain the value now. Since the input is then excluded from all reads of the module, it needs neither
+            // decorators nor any further transfer.
+            feedingImpl->read();
+            consumer.setAppAccessorFoldedConstant<UserType>(feedingImpl);
+            ++nFoldedConstants;
+            if(enableDebugMakeConnections) {
+              std::cout << "    Folded constant into '" << consumer.getQualifiedName() << "'" << std::endl;
+            }
+          }
+          else if(testableMode && consumer.getMode() == UpdateMode::push) {
             auto varId = getNextVariableId();
             auto pvarDec =
                 boost::make_shared<TestableModeAccessorDecorator<UserType>>(feedingImpl, true, false, varId, varId);
@@ -1247,14 +1755,14 @@ void Application::typedMakeConnection(VariableNetwork& network) {
 
 template<typename UserType>
 std::list<std::pair<boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>, VariableNetworkNode>> Application::
-    setConsumerImplementations(VariableNetworkNode const& feeder, std::list<VariableNetworkNode> consumers) {
+    setConsumerImplementations(VariableNetworkNode const& feeder, const std::vector<VariableNetworkNode>& consumers) {
   std::list<std::pair<boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>, VariableNetworkNode>>
       consumerImplPairs;
 
   /** Map of deviceAliases to their corresponding TriggerFanOuts */
   std::map<std::string, boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>> triggerFanOuts;
 
-  for(auto& consumer : consumers) {
+  for(auto consumer : consumers) {
     bool addToConsumerImplPairs{true};
     std::pair<boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>, VariableNetworkNode> pair{
         boost::shared_ptr<ChimeraTK::NDRegisterAccessor<UserType>>(), consumer};
@@ -1605,7 +2113,7 @@ void Application::CircularDependencyDetector::unregisterDependencyWait(VariableN
 /*********************************************************************************************************************/
 
 void Application::CircularDependencyDetector::startDetectBlockedModules() {
-  _thread = boost::thread([this] { detectBlockedModules(); });
+  _thread = Application::createThread([this] { detectBlockedModules(); });
 }
 
 /*********************************************************************************************************************/
@@ -45,6 +45,9 @@ namespace ChimeraTK {
     assert(!moduleThread.joinable()); // if the thread is already running,
                                       // moving is no longer allowed!
     ModuleImpl::operator=(std::move(other));
+    _priority = other._priority;
+    _readSpinTime = other._readSpinTime;
+    _threadStackSize = other._threadStackSize;
     return *this;
   }
 
@@ -53,7 +56,7 @@ namespace ChimeraTK {
   void ApplicationModule::run() {
     // start the module thread
     assert(!moduleThread.joinable());
-    moduleThread = boost::thread(&ApplicationModule::mainLoopWrapper, this);
+    moduleThread = Application::createThread([this] { mainLoopWrapper(); }, _threadStackSize);
   }
 
   /*********************************************************************************************************************/
@@ -94,15 +97,30 @@ namespace ChimeraTK {
 
   void ApplicationModule::mainLoopWrapper() {
     Application::registerThread("AM_" + getName());
+    Application::setThreadPriority(_priority);
 
     // Acquire testable mode lock, so from this point on we are running only one user thread concurrently
     Application::testableModeLock("start");
 
+    readInitialValues();
+
+    // We are holding the testable mode lock, so we are sure the mechanism will work now.
+    testableModeReached = true;
+
+    // enter the main loop
+    mainLoop();
+    Application::testableModeUnlock("terminate");
+  }
+
+  /*********************************************************************************************************************/
+
+  void ApplicationModule::readInitialValues() {
     // Read all variables once to obtain the initial values from the devices and from the control system persistency
     // layer. This is done in two steps, first for all poll-type variables and then for all push-types, because
     // poll-type reads might trigger distribution of values to push-type variables via a ConsumingFanOut.
+    // Inputs fed by folded constants have already obtained their value when making the connections.
     for(auto& variable : getAccessorListRecursive()) {
-      if(variable.getDirection().dir != VariableDirection::consuming) continue;
+      if(variable.getDirection().dir != VariableDirection::consuming || variable.isFoldedConstant()) continue;
       if(variable.getMode() == UpdateMode::poll) {
         assert(!variable.getAppAccessorNoType().getHighLevelImplElement()->getAccessModeFlags().has(
             AccessMode::wait_for_new_data));
@@ -118,25 +136,28 @@ namespace ChimeraTK {
         }
       }
     }
+    // A single deadline for all inputs, so waiting for the upstream modules does not add up per input
+    auto initialValueDeadline = boost::chrono::steady_clock::now() +
+        boost::chrono::milliseconds(Application::getInstance().orderedInitialValuesMaxWait.count());
     for(auto& variable : getAccessorListRecursive()) {
-      if(variable.getDirection().dir != VariableDirection::consuming) continue;
+      if(variable.getDirection().dir != VariableDirection::consuming || variable.isFoldedConstant()) continue;
       if(variable.getMode() == UpdateMode::push) {
         Application::testableModeUnlock("Initial value read for push-type " + variable.getName());
         Application::getInstance().circularDependencyDetector.registerDependencyWait(variable);
+        bool skipSuperseded = Application::getInstance().waitForUpstreamInitialValue(variable, initialValueDeadline);
         Application::testableModeLock("Initial value read for push-type " + variable.getName());
         variable.getAppAccessorNoType().read();
+        if(skipSuperseded) {
+          // see Application::enableOrderedInitialValues()
+          while(variable.getAppAccessorNoType().readNonBlocking()) {
+            ++Application::getInstance().nSupersededInitialValues;
+          }
+        }
         Application::testableModeUnlock("Initial value read for push-type " + variable.getName());
         Application::getInstance().circularDependencyDetector.unregisterDependencyWait(variable);
         Application::testableModeLock("Initial value read for push-type " + variable.getName());
       }
     }
-
-    // We are holding the testable mode lock, so we are sure the mechanism will work now.
-    testableModeReached = true;
-
-    // enter the main loop
-    mainLoop();
-    Application::testableModeUnlock("terminate");
   }
 
   /*********************************************************************************************************************/
@@ -152,55 +173,6 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
-  std::list<EntityOwner*> ApplicationModule::getInputModulesRecursively(std::list<EntityOwner*> startList) {
-    if(_recursionStopper.recursionDetected()) {
-      return startList;
-    }
-
-    // If this module is already in the list we found a circular dependency.
-    // Remember this for the next time the recursive scan calls this function
-    if(std::count(startList.begin(), startList.end(), this)) {
-      _recursionStopper.setRecursionDetected();
-    }
-
-    // Whether a cirular depencency has been detected or not, we must loop all inputs and add this module to the list so
-    // the calling code sees the second instance and can also detect the circle. The reason why we have to scan all
-    // inputs even if a circle is detected is this:
-    // * A single input starts the scan by adding it's owning module. At this point not all inputs if that module are in
-    // the circular network.
-    // * When a circle is detected, it might only be one of multiple entangled circled. If we would break the recursion
-    // and not scan all the
-    //   inputs this is sufficient to identify that the particular input is in a circle. But at this point we have to
-    //   tell in which network it is and have to scan the complete network to calculate the correct hash value.
-
-    startList.push_back(this); // first we add this module to the start list. We will call all inputs with it.
-    std::list<EntityOwner*> returnList{
-        startList}; // prepare the return list. Deltas from the inputs will be added to it.
-    for(auto& accessor : this->getAccessorListRecursive()) {
-      // not consumun from network -> not an input, just continue
-      if(accessor.getDirection().dir != VariableDirection::consuming) continue;
-
-      // find the feeder in the network
-      auto feeder = accessor.getOwner().getFeedingNode();
-      auto feedingModule = feeder.getOwningModule();
-      // CS module and DeviceModule nodes don't have an owning module set. As they stop the recursion anyway we just continue.
-      if(!feedingModule) {
-        continue;
-      }
-
-      auto thisInputsRecursiveModuleList = feedingModule->getInputModulesRecursively(startList);
-      // only add the modules that were added by the recursive search to the output list
-      assert(startList.size() <= thisInputsRecursiveModuleList.size());
-      auto copyStartIter = thisInputsRecursiveModuleList.begin();
-      std::advance(copyStartIter, startList.size());
-
-      returnList.insert(returnList.end(), copyStartIter, thisInputsRecursiveModuleList.end());
-    }
-    return returnList;
-  }
-
-  /*********************************************************************************************************************/
-
   size_t ApplicationModule::getCircularNetworkHash() {
     return _circularNetworkHash;
   }
@@ -218,6 +190,38 @@ namespace ChimeraTK {
     _circularNetworkHash = circularNetworkHash;
   }
 
+  /*********************************************************************************************************************/
+
+  void ApplicationModule::setPriority(ModulePriority priority) {
+    // the priority is evaluated when the connections are made
+    if(Application::getInstance().initialiseCalled) {
+      throw ChimeraTK::logic_error(
+          "Error: setPriority() called after the connections have been made for module \"" + _name + "\".");
+    }
+    _priority = priority;
+  }
+
+  /*********************************************************************************************************************/
+
+  void ApplicationModule::setReadSpinTime(std::chrono::nanoseconds maxSpinTime) {
+    // the spin time is evaluated when the connections are made
+    if(Application::getInstance().initialiseCalled) {
+      throw ChimeraTK::logic_error(
+          "Error: setReadSpinTime() called after the connections have been made for module \"" + _name + "\".");
+    }
+    _readSpinTime = maxSpinTime;
+  }
+
+  /*********************************************************************************************************************/
+
+  void ApplicationModule::setThreadStackSize(size_t stackSize) {
+    if(Application::getInstance().getLifeCycleState() != LifeCycleState::initialisation) {
+      throw ChimeraTK::logic_error(
+          "Error: setThreadStackSize() called after initialisation for module \"" + _name + "\".");
+    }
+    _threadStackSize = stackSize;
+  }
+
   /*********************************************************************************************************************/
   DataValidity ApplicationModule::getDataValidity() const {
     if(dataFaultCounter == 0) return DataValidity::ok;
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "CoalescingReadAnyGroup.h"
+
+#include "IntrospectionServer.h"
+
+#include <ChimeraTK/Exception.h>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  CoalescingReadAnyGroup::CoalescingReadAnyGroup(std::initializer_list<TransferElementAbstractor> list)
+  : _group(list), _elements(list) {
+    updateName();
+  }
+
+  /********************************************************************************************************************/
+
+  void CoalescingReadAnyGroup::add(TransferElementAbstractor element) {
+    _group.add(element);
+    _elements.push_back(element);
+  }
+
+  /********************************************************************************************************************/
+
+  void CoalescingReadAnyGroup::finalise() {
+    _group.finalise();
+    updateName();
+  }
+
+  /********************************************************************************************************************/
+
+  void CoalescingReadAnyGroup::setReadSpinTime(std::chrono::nanoseconds maxSpinTime) {
+    if(maxSpinTime.count() > 0) {
+      _spinWait.emplace(maxSpinTime);
+    }
+    else {
+      _spinWait.reset();
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void CoalescingReadAnyGroup::updateName() {
+    std::string name = "readAny(";
+    for(auto& element : _elements) {
+      if(&element != &_elements.front()) name += ", ";
+      name += element.getName();
+    }
+    name += ")";
+    _name = std::make_shared<const std::string>(std::move(name));
+  }
+
+  /********************************************************************************************************************/
+
+  const std::vector<TransferElementID>& CoalescingReadAnyGroup::readAny() {
+    _updates.clear();
+
+    // obtain the first update: either the one left over from the previous call, or wait for it
+    TransferElementID id;
+    if(_pending.isValid()) {
+      id = _pending;
+      _pending = TransferElementID();
+    }
+    else {
+      // Spin on the group as a whole: spinning inside the read of the individual elements is not possible, since the
+      // ReadAnyGroup waits for its notification queue before reading any element.
+      if(!_spinWait || !_spinWait->waitUntil([&] { return (id = _group.readAnyNonBlocking()).isValid(); })) {
+        // let the IntrospectionServer know which group we are (potentially) blocking on
+        auto status = detail::currentThreadStatus.get();
+        if(status) std::atomic_store(&status->blockedOnGroup, _name);
+        auto _ = cppext::finally([&] {
+          if(status) std::atomic_store(&status->blockedOnGroup, std::shared_ptr<const std::string>());
+        });
+        id = _group.readAny();
+      }
+    }
+    if(_spinWait) _spinWait->arrived();
+    _updates.push_back(id);
+    _version = getElement(id).getVersionNumber();
+
+    // collect all further updates of the same version which have already arrived
+    for(id = _group.readAnyNonBlocking(); id.isValid(); id = _group.readAnyNonBlocking()) {
+      if(getElement(id).getVersionNumber() != _version) {
+        _pending = id;
+        break;
+      }
+      _updates.push_back(id);
+    }
+
+    return _updates;
+  }
+
+  /********************************************************************************************************************/
+
+  const TransferElementAbstractor& CoalescingReadAnyGroup::getElement(const TransferElementID& id) const {
+    // groups are small, so a linear search is fast enough and avoids any allocation
+    for(auto& element : _elements) {
+      if(element.getId() == id) return element;
+    }
+    throw ChimeraTK::logic_error("CoalescingReadAnyGroup: update received for an element not in the group.");
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
@@ -0,0 +1,697 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "ConnectionModelCache.h"
+
+#include "Application.h"
+#include "DeviceModule.h"
+#include "VariableNetwork.h"
+
+#include <ChimeraTK/SupportedUserTypes.h>
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/fusion/algorithm.hpp>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  namespace {
+
+    /** Identifies the file format. Must be changed whenever the format changes. */
+    const std::string fileMagic{"ChimeraTK connection model v3"};
+
+    /** Index value for "no node" resp. "no owner" */
+    constexpr int64_t none = -1;
+
+    template<typename T>
+    void write(std::ostream& stream, const T& value) {
+      static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be written directly");
+      stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void write(std::ostream& stream, const std::string& value) {
+      write(stream, uint64_t(value.size()));
+      stream.write(value.data(), std::streamsize(value.size()));
+    }
+
+    template<typename T>
+    T read(std::istream& stream) {
+      T value{};
+      stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+      return value;
+    }
+
+    std::string readString(std::istream& stream) {
+      auto size = read<uint64_t>(stream);
+      if(!stream || size > (uint64_t(1) << 30)) {
+        stream.setstate(std::ios::failbit);
+        return {};
+      }
+      std::string value(size, '\0');
+      stream.read(value.data(), std::streamsize(size));
+      return value;
+    }
+
+    /** All value types which may appear in the model, by their (mangled) name */
+    const std::map<std::string, const std::type_info*>& getValueTypes() {
+      static const std::map<std::string, const std::type_info*> valueTypes = [] {
+        std::map<std::string, const std::type_info*> types{{typeid(AnyType).name(), &typeid(AnyType)}};
+        boost::fusion::for_each(userTypeMap(), [&](auto pair) {
+          using UserType = typename decltype(pair)::first_type;
+          types[typeid(UserType).name()] = &typeid(UserType);
+        });
+        return types;
+      }();
+      return valueTypes;
+    }
+
+    /** Serialise a constant value. Numeric values are stored as raw bytes, so no precision is lost. */
+    template<typename UserType>
+    std::string constantToString(const UserType& value) {
+      if constexpr(std::is_same<UserType, std::string>::value) {
+        return value;
+      }
+      else {
+        static_assert(std::is_trivially_copyable<UserType>::value, "Constants must be trivially copyable or strings");
+        return std::string(reinterpret_cast<const char*>(&value), sizeof(UserType));
+      }
+    }
+
+    /** Inverse of constantToString(). The size of the string must have been checked with isValidConstant(). */
+    template<typename UserType>
+    UserType constantFromString(const std::string& value) {
+      if constexpr(std::is_same<UserType, std::string>::value) {
+        return value;
+      }
+      else {
+        UserType result;
+        std::memcpy(&result, value.data(), sizeof(UserType));
+        return result;
+      }
+    }
+
+    /** Check whether the string can be converted with constantFromString() */
+    template<typename UserType>
+    bool isValidConstant(const std::string& value) {
+      return std::is_same<UserType, std::string>::value || value.size() == sizeof(UserType);
+    }
+
+    /** Serialised form of a VariableNetworkNode. Nodes are referred to by their index in the node table. */
+    struct NodeRecord {
+      int32_t type;
+      int32_t mode;
+      int32_t direction;
+      bool withReturn;
+      std::string valueType;
+      std::string unit;
+      std::string description;
+      std::string publicName;
+      std::string name;
+      std::string qualifiedName;
+      std::string deviceAlias;
+      std::string registerName;
+      uint64_t nElements;
+      std::vector<std::string> tags;
+      int64_t owningModule;  // index into ConnectionModelCache::_owners
+      int64_t accessor;      // index into ConnectionModelCache::_accessors (Application nodes only)
+      bool isAccessorNode;   // the node is the accessor's own node (and not a copy with an external trigger)
+      int64_t nodeToTrigger; // index into the node table
+      int64_t externalTrigger;
+      std::string constantValue; // Constant nodes only
+      uint64_t constantLength;
+
+      void write(std::ostream& stream) const;
+      void read(std::istream& stream);
+    };
+
+    void NodeRecord::write(std::ostream& stream) const {
+      using ChimeraTK::write;
+      write(stream, type);
+      write(stream, mode);
+      write(stream, direction);
+      write(stream, withReturn);
+      for(auto* string : {&valueType, &unit, &description, &publicName, &name, &qualifiedName, &deviceAlias,
+              &registerName}) {
+        write(stream, *string);
+      }
+      write(stream, nElements);
+      write(stream, uint64_t(tags.size()));
+      for(auto& tag : tags) write(stream, tag);
+      write(stream, owningModule);
+      write(stream, accessor);
+      write(stream, isAccessorNode);
+      write(stream, nodeToTrigger);
+      write(stream, externalTrigger);
+      write(stream, constantValue);
+      write(stream, constantLength);
+    }
+
+    void NodeRecord::read(std::istream& stream) {
+      type = ChimeraTK::read<int32_t>(stream);
+      mode = ChimeraTK::read<int32_t>(stream);
+      direction = ChimeraTK::read<int32_t>(stream);
+      withReturn = ChimeraTK::read<bool>(stream);
+      for(auto* string : {&valueType, &unit, &description, &publicName, &name, &qualifiedName, &deviceAlias,
+              &registerName}) {
+        *string = readString(stream);
+      }
+      nElements = ChimeraTK::read<uint64_t>(stream);
+      auto nTags = ChimeraTK::read<uint64_t>(stream);
+      for(uint64_t i = 0; i < nTags && stream; ++i) tags.push_back(readString(stream));
+      owningModule = ChimeraTK::read<int64_t>(stream);
+      accessor = ChimeraTK::read<int64_t>(stream);
+      isAccessorNode = ChimeraTK::read<bool>(stream);
+      nodeToTrigger = ChimeraTK::read<int64_t>(stream);
+      externalTrigger = ChimeraTK::read<int64_t>(stream);
+      constantValue = readString(stream);
+      constantLength = ChimeraTK::read<uint64_t>(stream);
+    }
+
+    /** Serialised form of a VariableNetwork */
+    struct NetworkRecord {
+      int64_t feeder;
+      uint64_t feederPosition;
+      std::vector<int64_t> consumers;
+      std::string valueType;
+      std::string unit;
+      std::string description;
+    };
+
+    /** Serialised form of an entry of Application::triggerOverrunSettings */
+    struct TriggerOverrunRecord {
+      int64_t trigger;
+      int32_t policy;
+      std::string statisticsPath;
+      std::vector<std::pair<std::string, std::string>> statistics; // device alias and name of the group
+    };
+
+  } // namespace
+
+  /********************************************************************************************************************/
+
+  ConnectionModelCache::ConnectionModelCache(Application& application, std::string fileName)
+  : _application(application), _fileName(std::move(fileName)) {}
+
+  /********************************************************************************************************************/
+
+  void ConnectionModelCache::collectOwners() {
+    _owners.clear();
+    _accessors.clear();
+
+    // The statistics groups are created while resolving the connections, so they must not be part of the key
+    std::vector<EntityOwner*> statistics;
+    auto addOwner = [&](EntityOwner* owner) {
+      if(dynamic_cast<detail::TriggerStatistics*>(owner)) {
+        statistics.push_back(owner);
+      }
+      else {
+        _owners.push_back(owner);
+      }
+    };
+    _owners.push_back(&_application);
+    for(auto* module : _application.getSubmoduleListRecursive()) addOwner(module);
+    for(auto& device : _application.deviceModuleMap) {
+      _owners.push_back(device.second);
+      for(auto* module : device.second->getSubmoduleListRecursive()) addOwner(module);
+    }
+    _nKeyOwners = _owners.size();
+    _owners.insert(_owners.end(), statistics.begin(), statistics.end());
+
+    for(auto* owner : _owners) {
+      for(auto& accessor : owner->getAccessorList()) _accessors.push_back(accessor);
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void ConnectionModelCache::scanModuleTree() {
+    if(!_owners.empty()) return;
+    collectOwners();
+
+    size_t hash = 0;
+    boost::hash_combine(hash, fileMagic);
+
+    // The connections defined in the code are not visible without evaluating them, so the cache is bound to the
+    // executable and to the application class. Changes outside the code are covered by the model version only.
+    struct stat executable {};
+    if(::stat("/proc/self/exe", &executable) != 0) {
+      std::cerr << "*** Warning: Connection model cache disabled, cannot inspect the executable: "
+                << std::strerror(errno) << std::endl;
+      _isCacheable = false;
+    }
+    boost::hash_combine(hash, uint64_t(executable.st_size));
+    boost::hash_combine(hash, int64_t(executable.st_mtim.tv_sec));
+    boost::hash_combine(hash, int64_t(executable.st_mtim.tv_nsec));
+    boost::hash_combine(hash, std::string(typeid(_application).name()));
+    boost::hash_combine(hash, _application.connectionModelVersion);
+
+    for(size_t i = 0; i < _nKeyOwners; ++i) {
+      auto* owner = _owners[i];
+      boost::hash_combine(hash, owner->getQualifiedName());
+      boost::hash_combine(hash, int(owner->getModuleType()));
+      for(auto& accessor : owner->getAccessorList()) {
+        boost::hash_combine(hash, accessor.getQualifiedName());
+        boost::hash_combine(hash, int(accessor.getType()));
+        boost::hash_combine(hash, int(accessor.getMode()));
+        boost::hash_combine(hash, int(accessor.getDirection().dir));
+        boost::hash_combine(hash, accessor.getDirection().withReturn);
+        boost::hash_combine(hash, accessor.getNumberOfElements());
+        boost::hash_combine(hash, std::string(accessor.getValueType().name()));
+        boost::hash_combine(hash, accessor.getUnit());
+        boost::hash_combine(hash, accessor.getDescription());
+        std::vector<std::string> tags(accessor.getTags().begin(), accessor.getTags().end());
+        std::sort(tags.begin(), tags.end());
+        boost::hash_combine(hash, tags);
+      }
+    }
+
+    // The register catalogues are expanded into accessors while defining the connections (e.g. by the
+    // ConnectingDeviceModule), so they are part of the module tree.
+    for(auto& device : _application.deviceModuleMap) {
+      boost::hash_combine(hash, device.first);
+      try {
+        Device dev(device.first);
+        for(auto& reg : dev.getRegisterCatalogue()) {
+          boost::hash_combine(hash, std::string(reg.getRegisterName()));
+          boost::hash_combine(hash, reg.getNumberOfElements());
+          boost::hash_combine(hash, reg.getNumberOfChannels());
+          boost::hash_combine(hash, reg.getNumberOfDimensions());
+          boost::hash_combine(hash, reg.isReadable());
+          boost::hash_combine(hash, reg.isWriteable());
+          boost::hash_combine(hash, reg.getSupportedAccessModes().has(AccessMode::wait_for_new_data));
+          auto& descriptor = reg.getDataDescriptor();
+          boost::hash_combine(hash, int(descriptor.fundamentalType()));
+          if(descriptor.fundamentalType() == DataDescriptor::FundamentalType::numeric) {
+            boost::hash_combine(hash, descriptor.isIntegral());
+            boost::hash_combine(hash, descriptor.isSigned());
+            boost::hash_combine(hash, descriptor.nDigits());
+            boost::hash_combine(hash, descriptor.nFractionalDigits());
+          }
+        }
+      }
+      catch(ChimeraTK::logic_error& e) {
+        std::cerr << "*** Warning: Connection model cache disabled, cannot obtain the register catalogue of device '"
+                  << device.first << "': " << e.what() << std::endl;
+        _isCacheable = false;
+      }
+      catch(ChimeraTK::runtime_error& e) {
+        std::cerr << "*** Warning: Connection model cache disabled, cannot obtain the register catalogue of device '"
+                  << device.first << "': " << e.what() << std::endl;
+        _isCacheable = false;
+      }
+    }
+    _cacheKey = hash;
+  }
+
+  /********************************************************************************************************************/
+
+  void ConnectionModelCache::save() {
+    scanModuleTree();
+    if(!_isCacheable) return;
+    auto fail = [&](const std::string& reason) {
+      std::cerr << "*** Warning: Cannot store the connection model in '" << _fileName << "': " << reason << std::endl;
+    };
+
+    std::unordered_map<const EntityOwner*, int64_t> ownerIndices;
+    for(size_t i = 0; i < _owners.size(); ++i) ownerIndices[_owners[i]] = int64_t(i);
+    std::unordered_map<const TransferElementAbstractor*, int64_t> accessorIndices;
+    for(size_t i = 0; i < _accessors.size(); ++i) accessorIndices[_accessors[i].pdata->appNode] = int64_t(i);
+
+    // build the node table, including nodes which are only referenced by other nodes
+    std::vector<VariableNetworkNode> nodes;
+    std::unordered_map<const VariableNetworkNode_data*, int64_t> nodeIndices;
+    std::function<int64_t(const VariableNetworkNode&)> addNode = [&](const VariableNetworkNode& node) -> int64_t {
+      if(!node.pdata || node.getType() == NodeType::invalid) return none;
+      auto [it, inserted] = nodeIndices.try_emplace(node.pdata.get(), int64_t(nodes.size()));
+      if(inserted) {
+        nodes.push_back(node);
+        addNode(node.pdata->nodeToTrigger);
+        addNode(node.pdata->externalTrigger);
+      }
+      return it->second;
+    };
+
+    std::vector<NetworkRecord> networks;
+    for(auto& network : _application.networkList) {
+      NetworkRecord record;
+      record.feeder = network.hasFeedingNode() ? addNode(network.getFeedingNode()) : none;
+      record.feederPosition = network._feederPosition;
+      for(auto& consumer : network.getConsumingNodes()) record.consumers.push_back(addNode(consumer));
+      record.valueType = network.getValueType().name();
+      record.unit = network.getUnit();
+      record.description = network.getDescription();
+      if(!getValueTypes().count(record.valueType)) return fail("unknown value type " + record.valueType);
+      networks.push_back(std::move(record));
+    }
+    std::vector<std::pair<std::string, int64_t>> controlSystemVariables;
+    for(auto& variable : _application.controlSystemVariables) {
+      controlSystemVariables.emplace_back(variable.first, addNode(variable.second));
+    }
+    std::vector<int64_t> constants;
+    for(auto& constant : _application.constantList) constants.push_back(addNode(constant));
+
+    // Side effects of defineConnections() and finaliseNetworks() which are not part of the networks
+    std::vector<std::pair<std::string, std::vector<std::string>>> statisticsGroups;
+    for(auto& device : _application.deviceModuleMap) {
+      if(device.second->triggerStatistics.empty()) continue;
+      auto& names = statisticsGroups.emplace_back(device.first, std::vector<std::string>{}).second;
+      for(auto& group : device.second->triggerStatistics) names.push_back(group.getName());
+    }
+    std::vector<TriggerOverrunRecord> triggerOverrunSettings;
+    for(auto& settings : _application.triggerOverrunSettings) {
+      TriggerOverrunRecord record;
+      record.trigger = addNode(settings.first);
+      if(record.trigger == none) return fail("invalid trigger node with overrun policy");
+      record.policy = int32_t(settings.second.policy);
+      record.statisticsPath = settings.second.statisticsPath;
+      for(auto& statistics : settings.second.statistics) {
+        record.statistics.emplace_back(statistics.first, statistics.second->getName());
+      }
+      triggerOverrunSettings.push_back(std::move(record));
+    }
+
+    std::vector<NodeRecord> records;
+    for(auto& node : nodes) {
+      auto& data = *node.pdata;
+      NodeRecord record;
+      record.type = int32_t(data.type);
+      record.mode = int32_t(data.mode);
+      record.direction = int32_t(data.direction.dir);
+      record.withReturn = data.direction.withReturn;
+      record.valueType = data.valueType->name();
+      if(!getValueTypes().count(record.valueType)) return fail("unknown value type " + record.valueType);
+      record.unit = data.unit;
+      record.description = data.description;
+      record.publicName = data.publicName;
+      record.name = data.name;
+      record.qualifiedName = data.qualifiedName;
+      record.deviceAlias = data.deviceAlias;
+      record.registerName = data.registerName;
+      record.nElements = data.nElements;
+      record.tags.assign(data.tags.begin(), data.tags.end());
+      record.owningModule = none;
+      if(data.owningModule) {
+        auto it = ownerIndices.find(data.owningModule);
+        if(it == ownerIndices.end()) return fail("owner of '" + data.qualifiedName + "' not found in module tree");
+        record.owningModule = it->second;
+      }
+      record.accessor = none;
+      record.isAccessorNode = false;
+      if(data.type == NodeType::Application) {
+        auto it = accessorIndices.find(data.appNode);
+        if(it == accessorIndices.end()) return fail("accessor '" + data.qualifiedName + "' not found in module tree");
+        record.accessor = it->second;
+        record.isAccessorNode = (_accessors[size_t(it->second)].pdata == node.pdata);
+      }
+      record.nodeToTrigger = addNode(data.nodeToTrigger);
+      record.externalTrigger = addNode(data.externalTrigger);
+      record.constantLength = 0;
+      if(data.type == NodeType::Constant) {
+        callForType(*data.valueType, [&](auto t) {
+          using UserType = decltype(t);
+          auto creator = boost::dynamic_pointer_cast<ConstantAccessorCreatorImpl<UserType>>(data.constNodeCreator);
+          assert(creator);
+          record.constantValue = constantToString(creator->value);
+          record.constantLength = creator->length;
+        });
+      }
+      records.push_back(std::move(record));
+    }
+
+    // write to a temporary file first and rename it, so concurrent processes never see an incomplete file
+    std::string temporaryFileName = _fileName + ".tmp" + std::to_string(getpid());
+    {
+      std::ofstream file(temporaryFileName, std::ios::binary | std::ios::trunc);
+      write(file, fileMagic);
+      write(file, uint64_t(_cacheKey));
+      write(file, uint64_t(records.size()));
+      for(auto& record : records) record.write(file);
+      write(file, uint64_t(networks.size()));
+      for(auto& network : networks) {
+        write(file, network.feeder);
+        write(file, network.feederPosition);
+        write(file, uint64_t(network.consumers.size()));
+        for(auto consumer : network.consumers) write(file, consumer);
+        write(file, network.valueType);
+        write(file, network.unit);
+        write(file, network.description);
+      }
+      write(file, uint64_t(controlSystemVariables.size()));
+      for(auto& variable : controlSystemVariables) {
+        write(file, variable.first);
+        write(file, variable.second);
+      }
+      write(file, uint64_t(constants.size()));
+      for(auto constant : constants) write(file, constant);
+      write(file, uint64_t(statisticsGroups.size()));
+      for(auto& [deviceAlias, names] : statisticsGroups) {
+        write(file, deviceAlias);
+        write(file, uint64_t(names.size()));
+        for(auto& name : names) write(file, name);
+      }
+      write(file, uint64_t(triggerOverrunSettings.size()));
+      for(auto& settings : triggerOverrunSettings) {
+        write(file, settings.trigger);
+        write(file, settings.policy);
+        write(file, settings.statisticsPath);
+        write(file, uint64_t(settings.statistics.size()));
+        for(auto& [deviceAlias, name] : settings.statistics) {
+          write(file, deviceAlias);
+          write(file, name);
+        }
+      }
+      if(!file) {
+        std::remove(temporaryFileName.c_str());
+        return fail("write error");
+      }
+    }
+    if(std::rename(temporaryFileName.c_str(), _fileName.c_str()) != 0) {
+      std::remove(temporaryFileName.c_str());
+      fail("cannot rename temporary file");
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  bool ConnectionModelCache::restore() {
+    std::ifstream file(_fileName, std::ios::binary);
+    if(!file || readString(file) != fileMagic) return false;
+    scanModuleTree();
+    if(!_isCacheable || read<uint64_t>(file) != _cacheKey) return false;
+
+    // Read and validate everything before touching the application
+    auto& valueTypes = getValueTypes();
+    auto nNodes = read<uint64_t>(file);
+    if(!file || nNodes > (uint64_t(1) << 32)) return false;
+    auto isNode = [&](int64_t index) { return index == none || (index >= 0 && uint64_t(index) < nNodes); };
+    std::vector<NodeRecord> records(nNodes);
+    std::unordered_set<int64_t> usedAccessors;
+    for(auto& record : records) {
+      record.read(file);
+      if(!file || !valueTypes.count(record.valueType) || !isNode(record.nodeToTrigger) ||
+          !isNode(record.externalTrigger)) {
+        return false;
+      }
+      if(record.isAccessorNode && (record.accessor == none || !usedAccessors.insert(record.accessor).second)) {
+        return false;
+      }
+      if(NodeType(record.type) == NodeType::Constant) {
+        bool valid = false;
+        callForType(*valueTypes.at(record.valueType), [&](auto t) {
+          valid = isValidConstant<decltype(t)>(record.constantValue);
+        });
+        if(!valid) return false;
+      }
+    }
+
+    auto nNetworks = read<uint64_t>(file);
+    if(!file || nNetworks > nNodes) return false;
+    std::vector<NetworkRecord> networks(nNetworks);
+    for(auto& network : networks) {
+      network.feeder = read<int64_t>(file);
+      network.feederPosition = read<uint64_t>(file);
+      auto nConsumers = read<uint64_t>(file);
+      if(!file || nConsumers > nNodes) return false;
+      for(uint64_t i = 0; i < nConsumers; ++i) network.consumers.push_back(read<int64_t>(file));
+      network.valueType = readString(file);
+      network.unit = readString(file);
+      network.description = readString(file);
+      if(!file || !valueTypes.count(network.valueType) || !isNode(network.feeder)) return false;
+      if(network.feederPosition > nConsumers) return false;
+      for(auto consumer : network.consumers) {
+        if(consumer == none || !isNode(consumer)) return false;
+      }
+    }
+
+    auto nControlSystemVariables = read<uint64_t>(file);
+    if(!file || nControlSystemVariables > nNodes) return false;
+    std::vector<std::pair<std::string, int64_t>> controlSystemVariables;
+    for(uint64_t i = 0; i < nControlSystemVariables; ++i) {
+      auto name = readString(file);
+      auto index = read<int64_t>(file);
+      if(!file || index == none || !isNode(index)) return false;
+      controlSystemVariables.emplace_back(std::move(name), index);
+    }
+
+    auto nConstants = read<uint64_t>(file);
+    if(!file || nConstants > nNodes) return false;
+    std::vector<int64_t> constants;
+    for(uint64_t i = 0; i < nConstants; ++i) {
+      constants.push_back(read<int64_t>(file));
+      if(!file || constants.back() == none || !isNode(constants.back())) return false;
+    }
+
+    auto nStatisticsDevices = read<uint64_t>(file);
+    if(!file || nStatisticsDevices > _application.deviceModuleMap.size()) return false;
+    std::map<std::string, std::vector<std::string>> statisticsGroups;
+    for(uint64_t i = 0; i < nStatisticsDevices; ++i) {
+      auto deviceAlias = readString(file);
+      auto nGroups = read<uint64_t>(file);
+      if(!file || !_application.deviceModuleMap.count(deviceAlias) || statisticsGroups.count(deviceAlias)) return false;
+      if(nGroups > nNodes) return false;
+      auto& names = statisticsGroups[deviceAlias];
+      for(uint64_t k = 0; k < nGroups; ++k) names.push_back(readString(file));
+      if(!file) return false;
+    }
+    auto isStatisticsGroup = [&](const std::string& deviceAlias, const std::string& name) {
+      auto it = statisticsGroups.find(deviceAlias);
+      return it != statisticsGroups.end() && std::count(it->second.begin(), it->second.end(), name) == 1;
+    };
+
+    auto nTriggerOverrunSettings = read<uint64_t>(file);
+    if(!file || nTriggerOverrunSettings > nNodes) return false;
+    std::vector<TriggerOverrunRecord> triggerOverrunSettings(nTriggerOverrunSettings);
+    for(auto& settings : triggerOverrunSettings) {
+      settings.trigger = read<int64_t>(file);
+      settings.policy = read<int32_t>(file);
+      settings.statisticsPath = readString(file);
+      auto nStatistics = read<uint64_t>(file);
+      if(!file || settings.trigger == none || !isNode(settings.trigger)) return false;
+      if(TriggerOverrunPolicy(settings.policy) != TriggerOverrunPolicy::processAll &&
+          TriggerOverrunPolicy(settings.policy) != TriggerOverrunPolicy::skipStale) {
+        return false;
+      }
+      if(nStatistics > _application.deviceModuleMap.size()) return false;
+      for(uint64_t i = 0; i < nStatistics; ++i) {
+        auto deviceAlias = readString(file);
+        auto name = readString(file);
+        if(!file || !isStatisticsGroup(deviceAlias, name)) return false;
+        settings.statistics.emplace_back(std::move(deviceAlias), std::move(name));
+      }
+    }
+
+    // The statistics groups must exist before the owners and accessors can be referred to by their indices. Remove them
+    // again if the indices turn out to be invalid, so the application is not modified.
+    for(auto& [deviceAlias, names] : statisticsGroups) {
+      auto* deviceModule = _application.deviceModuleMap.at(deviceAlias);
+      for(auto& name : names) deviceModule->triggerStatistics.emplace_back(deviceModule, name);
+    }
+    collectOwners();
+    for(auto& record : records) {
+      if((record.owningModule != none &&
+             (record.owningModule < 0 || uint64_t(record.owningModule) >= _owners.size())) ||
+          (record.accessor != none && (record.accessor < 0 || uint64_t(record.accessor) >= _accessors.size()))) {
+        for(auto& device : _application.deviceModuleMap) device.second->triggerStatistics.clear();
+        return false;
+      }
+    }
+
+    // Create the nodes. Accessor nodes are re-used, so the accessors refer to the restored networks.
+    std::vector<VariableNetworkNode> nodes;
+    for(auto& record : records) {
+      VariableNetworkNode node;
+      if(record.isAccessorNode) node = _accessors[size_t(record.accessor)];
+      auto& data = *node.pdata;
+      data.type = NodeType(record.type);
+      data.mode = UpdateMode(record.mode);
+      data.direction = {decltype(VariableDirection::dir)(record.direction), record.withReturn};
+      data.valueType = valueTypes.at(record.valueType);
+      data.unit = record.unit;
+      data.description = record.description;
+      data.publicName = record.publicName;
+      data.name = record.name;
+      data.qualifiedName = record.qualifiedName;
+      data.deviceAlias = record.deviceAlias;
+      data.registerName = record.registerName;
+      data.nElements = record.nElements;
+      data.tags = {record.tags.begin(), record.tags.end()};
+      data.owningModule = record.owningModule == none ? nullptr : _owners[size_t(record.owningModule)];
+      if(record.accessor != none) data.appNode = _accessors[size_t(record.accessor)].pdata->appNode;
+      if(data.type == NodeType::Constant) {
+        callForType(*data.valueType, [&](auto t) {
+          using UserType = decltype(t);
+          data.constNodeCreator.reset(new ConstantAccessorCreatorImpl<UserType>(
+              constantFromString<UserType>(record.constantValue), record.constantLength));
+        });
+      }
+      nodes.push_back(node);
+    }
+    for(size_t i = 0; i < nodes.size(); ++i) {
+      if(records[i].nodeToTrigger != none) nodes[i].pdata->nodeToTrigger = nodes[size_t(records[i].nodeToTrigger)];
+      if(records[i].externalTrigger != none) {
+        nodes[i].pdata->externalTrigger = nodes[size_t(records[i].externalTrigger)];
+      }
+    }
+
+    // Create the networks
+    for(auto& record : networks) {
+      auto& network = _application.networkList.emplace_back();
+      if(record.feeder != none) {
+        network._feeder = nodes[size_t(record.feeder)];
+        network._feeder.setOwner(&network);
+      }
+      for(auto consumer : record.consumers) {
+        nodes[size_t(consumer)].setOwner(&network);
+        network.addConsumer(nodes[size_t(consumer)], network._consumers.size());
+      }
+      network._feederPosition = record.feederPosition;
+      network.valueType = valueTypes.at(record.valueType);
+      network.engineeringUnit = record.unit;
+      network.description = record.description;
+    }
+
+    for(auto& variable : controlSystemVariables) {
+      _application.controlSystemVariables[variable.first] = nodes[size_t(variable.second)];
+    }
+    for(auto constant : constants) _application.constantList.push_back(nodes[size_t(constant)]);
+
+    // Side effects of defineConnections() which are not part of the connection model
+    for(auto* owner : _owners) {
+      auto* connectingDeviceModule = dynamic_cast<ConnectingDeviceModule*>(owner);
+      if(connectingDeviceModule) connectingDeviceModule->addInitialisationHandlerToDevice();
+    }
+    _application.triggerOverrunSettings.clear();
+    for(auto& record : triggerOverrunSettings) {
+      auto& settings = _application.triggerOverrunSettings[nodes[size_t(record.trigger)]];
+      settings.policy = TriggerOverrunPolicy(record.policy);
+      settings.statisticsPath = record.statisticsPath;
+      for(auto& [deviceAlias, name] : record.statistics) {
+        for(auto& group : _application.deviceModuleMap.at(deviceAlias)->triggerStatistics) {
+          if(group.getName() == name) settings.statistics[deviceAlias] = &group;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
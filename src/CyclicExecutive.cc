@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "CyclicExecutive.h"
+
+#include "Application.h"
+
+#include <chrono>
+
+namespace ChimeraTK {
+
+  /*********************************************************************************************************************/
+
+  void CyclicModule::mainLoop() {
+    auto group = readAnyGroup();
+    while(true) {
+      step();
+      writeAll();
+      group.readAny();
+    }
+  }
+
+  /*********************************************************************************************************************/
+
+  void CyclicModule::run() {
+    // modules in a chain are executed in the thread of the CyclicExecutive
+    if(_executive != nullptr) return;
+    ApplicationModule::run();
+  }
+
+  /*********************************************************************************************************************/
+  /*********************************************************************************************************************/
+
+  CyclicExecutive::CyclicExecutive(EntityOwner* owner, const std::string& name, const std::string& description,
+      HierarchyModifier hierarchyModifier, const std::unordered_set<std::string>& tags)
+  : ApplicationModule(owner, name, description, hierarchyModifier, tags) {
+    setPriority(ModulePriority::realtime);
+  }
+
+  /*********************************************************************************************************************/
+
+  void CyclicExecutive::addModule(CyclicModule& module) {
+    if(Application::getInstance().getLifeCycleState() != LifeCycleState::initialisation) {
+      throw ChimeraTK::logic_error("CyclicExecutive::addModule() called after initialisation.");
+    }
+    if(module._executive != nullptr) {
+      throw ChimeraTK::logic_error("CyclicExecutive::addModule(): Module '" + module.getQualifiedName() +
+          "' is already executed by '" + module._executive->getQualifiedName() + "'.");
+    }
+    module._executive = this;
+    _statistics.emplace_back(this, module.getName(), "Execution time statistics of " + module.getQualifiedName());
+    _chain.push_back({&module, &_statistics.back(), {}, {}});
+  }
+
+  /*********************************************************************************************************************/
+
+  double CyclicExecutive::execute(ChainElement& element, bool updateInputs) {
+    auto start = std::chrono::steady_clock::now();
+    if(updateInputs) {
+      element.module->setCurrentVersionNumber(getCurrentVersionNumber());
+      for(auto* input : element.inputs) input->readLatest();
+    }
+    element.module->step();
+    auto version = element.module->getCurrentVersionNumber();
+    for(auto* output : element.outputs) output->write(version);
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    return duration.count();
+  }
+
+  /*********************************************************************************************************************/
+
+  void CyclicExecutive::mainLoop() {
+    // Resolve the accessors of all modules once, so the cycle does not need to walk the module hierarchy.
+    for(auto& element : _chain) {
+      for(auto& variable : element.module->getAccessorListRecursive()) {
+        if(variable.getDirection().dir == VariableDirection::consuming) {
+          if(!variable.isFoldedConstant()) element.inputs.push_back(&variable.getAppAccessorNoType());
+        }
+        else {
+          element.outputs.push_back(&variable.getAppAccessorNoType());
+        }
+      }
+    }
+
+    // Obtain the initial values of each module in the order of the chain. Each module writes its outputs before the
+    // next module reads its initial values, so data flowing along the chain does not block.
+    for(auto& element : _chain) {
+      element.module->readInitialValues();
+      element.module->testableModeReached = true;
+      element.statistics->stepTime = execute(element, false);
+      element.statistics->worstStepTime = 0.;
+    }
+    cycleTime = 0.;
+    worstCycleTime = 0.;
+    nOverruns = 0;
+    writeAll(); // includes the statistics of the modules
+
+    bool triggerPending = false;
+    while(true) {
+      if(!triggerPending) trigger.read();
+
+      auto start = std::chrono::steady_clock::now();
+      for(auto& element : _chain) {
+        auto duration = execute(element, true);
+        element.statistics->stepTime = duration;
+        if(duration > element.statistics->worstStepTime) element.statistics->worstStepTime = duration;
+      }
+      std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+      cycleTime = duration.count();
+      if(duration.count() > worstCycleTime) worstCycleTime = duration.count();
+
+      // If the next trigger has already arrived, the cycle has overrun. Process the next cycle immediately.
+      triggerPending = trigger.readNonBlocking();
+      if(triggerPending) ++nOverruns;
+
+      // publish the statistics (including the ones of the modules) after the cycle, so it does not delay the modules
+      writeAll();
+    }
+  }
+
+  /*********************************************************************************************************************/
+
+  void CyclicExecutive::terminate() {
+    if(moduleThread.joinable()) {
+      moduleThread.interrupt();
+      while(!moduleThread.try_join_for(boost::chrono::milliseconds(10))) {
+        // The thread might wait for the trigger or for an initial value of any module in the chain, so send
+        // interrupt() to the variables of all these modules.
+        std::list<EntityOwner*> modules{this};
+        for(auto& element : _chain) modules.push_back(element.module);
+        for(auto* module : modules) {
+          for(auto& var : module->getAccessorListRecursive()) {
+            auto el{var.getAppAccessorNoType().getHighLevelImplElement()};
+            if(el->getAccessModeFlags().has(AccessMode::wait_for_new_data)) {
+              el->interrupt();
+            }
+          }
+        }
+      }
+    }
+    assert(!moduleThread.joinable());
+  }
+
+  /*********************************************************************************************************************/
+
+} /* namespace ChimeraTK */
@@ -53,6 +53,9 @@ namespace ChimeraTK {
       return *this;
     }
 
+    TriggerStatistics::TriggerStatistics(DeviceModule* owner, const std::string& name)
+    : VariableGroup(owner, name, "Statistics of reading the device with an external trigger") {}
+
   } // namespace detail
 
   /*********************************************************************************************************************/
@@ -315,6 +318,7 @@ namespace ChimeraTK {
 
     while(true) {
       // [Spec: 2.3.1] (Re)-open the device.
+      _recoveryState = RecoveryState::opening;
       do {
         owner->testableModeUnlock("Wait before open/recover device");
         usleep(500000);
@@ -361,6 +365,7 @@ namespace ChimeraTK {
       }
 
       // [Spec: 2.3.2] Run initialisation handlers
+      _recoveryState = RecoveryState::initialising;
       try {
         for(auto& initHandler : initialisationHandlers) {
           initHandler(this);
@@ -382,6 +387,7 @@ namespace ChimeraTK {
       // We are now entering the critical recovery section. It is protected by the recovery mutex until the
       // deviceHasError flag has been cleared.
       boost::unique_lock<boost::shared_mutex> recoveryLock(recoveryMutex);
+      _recoveryState = RecoveryState::writingRecoveryValues;
       try {
         // sort recovery helpers according to write order
         recoveryHelpers.sort([](boost::shared_ptr<RecoveryHelper>& a, boost::shared_ptr<RecoveryHelper>& b) {
@@ -408,6 +414,7 @@ namespace ChimeraTK {
       errorLock.lock();
       deviceHasError = false;
       errorLock.unlock();
+      _recoveryState = RecoveryState::functional;
 
       recoveryLock.unlock();
 
@@ -470,6 +477,8 @@ namespace ChimeraTK {
       errorLock.unlock();
 
       // [ExceptionHandling Spec: C.3.3.15] Wait for all synchronous transfers to finish before starting recovery.
+      ++_exceptionCount;
+      _recoveryState = RecoveryState::waitingForTransfers;
       while(synchronousTransferCounter > 0) {
         usleep(1000);
       }
@@ -502,7 +511,7 @@ namespace ChimeraTK {
   void DeviceModule::run() {
     // start the module thread
     assert(!moduleThread.joinable());
-    moduleThread = boost::thread(&DeviceModule::handleException, this);
+    moduleThread = Application::createThread([this] { handleException(); });
   }
 
   /*********************************************************************************************************************/
@@ -577,15 +586,6 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
-  std::list<EntityOwner*> DeviceModule::getInputModulesRecursively(std::list<EntityOwner*> startList) {
-    // The DeviceModule is the end of the recursion, and is not considered recursive to itself.
-    // There will always be circular connections to the CS module which does not pose a problem.
-    // Just return the startList without adding anything (not even the DeviceModule itself)
-    return startList;
-  }
-
-  /*********************************************************************************************************************/
-
   size_t DeviceModule::getCircularNetworkHash() {
     return 0; // The device module is never part of a circular network
   }
@@ -637,11 +637,17 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
-  void ConnectingDeviceModule::defineConnections() {
-    // add initialisation handler, if requested
+  void ConnectingDeviceModule::addInitialisationHandlerToDevice() {
     if(_initHandler != nullptr) {
       _dm->addInitialisationHandler(_initHandler);
     }
+  }
+
+  /*********************************************************************************************************************/
+
+  void ConnectingDeviceModule::defineConnections() {
+    // add initialisation handler, if requested
+    addInitialisationHandlerToDevice();
 
     // split up triggerPath
     auto path = HierarchyModifyingGroup::getPathName(triggerPath);
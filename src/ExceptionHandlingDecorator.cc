@@ -4,6 +4,7 @@
 
 #include "DeviceModule.h"
 
+#include <algorithm>
 #include <functional>
 
 namespace ChimeraTK {
@@ -38,6 +39,13 @@ namespace ChimeraTK {
       // version number and write order are still {nullptr} and 0 (i.e. invalid)
       _recoveryHelper = boost::make_shared<RecoveryHelper>(_recoveryAccessor, VersionNumber(nullptr), 0);
       _deviceModule->addRecoveryAccessor(_recoveryHelper);
+
+      // partial writes are only possible for one-dimensional registers fed by an application accessor
+      if(networkNode.hasOwner() && networkNode.getOwner().hasFeedingNode() &&
+          _recoveryAccessor->getNumberOfChannels() == 1) {
+        _dirtyRange = networkNode.getOwner().getFeedingNode().getDirtyRange();
+        _deviceAlias = deviceAlias;
+      }
     }
     else if(_direction.dir == VariableDirection::feeding) {
       _deviceModule->readRegisterPaths.push_back(registerName);
@@ -67,9 +75,21 @@ namespace ChimeraTK {
           _dataLostInPreviousWrite = true;
         }
 
-        // Access to _recoveryAccessor is only possible channel-wise
-        for(unsigned int ch = 0; ch < _recoveryAccessor->getNumberOfChannels(); ++ch) {
-          _recoveryAccessor->accessChannel(ch) = buffer_2D[ch];
+        // The recovery accessor holds the complete value only after a full write. Until then, partial writes are
+        // treated as full writes, otherwise the recovery would write the untouched elements with zeros.
+        _isPartialWrite = _dirtyRange && _dirtyRange->isPartial() &&
+            _recoveryHelper->versionNumber != VersionNumber(nullptr);
+        if(_isPartialWrite) {
+          // only the modified elements are copied, the recovery accessor still holds the rest of the previous value
+          auto first = buffer_2D[0].begin() + long(_dirtyRange->first());
+          std::copy(first, first + long(_dirtyRange->count()),
+              _recoveryAccessor->accessChannel(0).begin() + long(_dirtyRange->first()));
+        }
+        else {
+          // Access to _recoveryAccessor is only possible channel-wise
+          for(unsigned int ch = 0; ch < _recoveryAccessor->getNumberOfChannels(); ++ch) {
+            _recoveryAccessor->accessChannel(ch) = buffer_2D[ch];
+          }
         }
         _recoveryHelper->versionNumber = versionNumber;
         _recoveryHelper->writeOrder = _deviceModule->writeOrder();
@@ -91,6 +111,44 @@ namespace ChimeraTK {
 
     } // lock guard goes out of scope
 
+    if(_isPartialWrite) {
+      // Write only the modified window of the register. The accessors are cached per window.
+      if(!_windowAccessor || _windowFirst != _dirtyRange->first() || _windowCount != _dirtyRange->count()) {
+        auto window = std::make_pair(_dirtyRange->first(), _dirtyRange->count());
+        auto cached = _windowAccessors.find(window);
+        if(cached != _windowAccessors.end()) {
+          _windowAccessor = cached->second;
+        }
+        else {
+          try {
+            // same backend and register path as the target, see Application::createDeviceVariable()
+            auto accessor = Application::getInstance().deviceMap.at(_deviceAlias)->getRegisterAccessor<UserType>(
+                _target->getName(), window.second, window.first, {});
+            if(_windowAccessors.size() >= maxWindowAccessors) _windowAccessors.clear();
+            _windowAccessors[window] = accessor;
+            _windowAccessor = accessor;
+          }
+          catch(ChimeraTK::runtime_error& e) {
+            // The data is already in the recovery accessor and will be written when the device has recovered. The
+            // transfer counter must be released before reporting, since the DeviceModule waits for it.
+            _windowAccessor.reset();
+            _inhibitWriteTransfer = true;
+            --_deviceModule->synchronousTransferCounter;
+            this->_exceptionBackend->setException();
+            _deviceModule->reportException(std::string(e.what()) + " (seen by '" + _target->getName() + "')");
+            return;
+          }
+        }
+        _windowFirst = window.first;
+        _windowCount = window.second;
+      }
+      auto first = buffer_2D[0].begin() + long(_windowFirst);
+      std::copy(first, first + long(_windowCount), _windowAccessor->accessChannel(0).begin());
+      _windowAccessor->setDataValidity(this->_dataValidity);
+      _windowAccessor->preWrite(type, versionNumber);
+      return;
+    }
+
     // Now delegate call to the generic decorator, which swaps the buffer, without adding our exception handling with
     // the generic transfer preWrite and postWrite are only delegated if the transfer is allowed.
     ChimeraTK::NDRegisterAccessorDecorator<UserType>::doPreWrite(type, versionNumber);
@@ -106,7 +164,13 @@ namespace ChimeraTK {
     if(!_inhibitWriteTransfer) {
       --_deviceModule->synchronousTransferCounter;
       try {
-        ChimeraTK::NDRegisterAccessorDecorator<UserType>::doPostWrite(type, versionNumber);
+        if(_isPartialWrite) {
+          _windowAccessor->setActiveException(this->_activeException);
+          _windowAccessor->postWrite(type, versionNumber);
+        }
+        else {
+          ChimeraTK::NDRegisterAccessorDecorator<UserType>::doPostWrite(type, versionNumber);
+        }
         {
           auto recoverylock{_deviceModule->getRecoverySharedLock()};
           // the transfer was successful or doPostRead did not throw and we reach this point,
@@ -208,11 +272,14 @@ namespace ChimeraTK {
 
   template<typename UserType>
   bool ExceptionHandlingDecorator<UserType>::doWriteTransfer(VersionNumber versionNumber) {
-    return genericWriteWrapper([&] { return _target->writeTransferDestructively(versionNumber); });
+    return doWriteTransferDestructively(versionNumber);
   }
 
   template<typename UserType>
   bool ExceptionHandlingDecorator<UserType>::doWriteTransferDestructively(VersionNumber versionNumber) {
+    if(_isPartialWrite) {
+      return genericWriteWrapper([&] { return _windowAccessor->writeTransferDestructively(versionNumber); });
+    }
     return genericWriteWrapper([&] { return _target->writeTransferDestructively(versionNumber); });
   }
 
@@ -5,8 +5,6 @@
 #include "ApplicationModule.h"
 #include "VariableGroup.h"
 
-#include <boost/algorithm/string.hpp>
-
 namespace ChimeraTK {
 
   HierarchyModifyingGroup::HierarchyModifyingGroup(EntityOwner* owner, std::string qualifiedName,
@@ -22,27 +20,28 @@ namespace ChimeraTK {
       moveToRoot = true;
     }
 
-    // Split path into pieces
-    std::vector<std::string> splittedPath;
-    boost::split(splittedPath, qualifiedName, boost::is_any_of("/"));
+    // Split path into interned pieces
+    std::vector<StringInterner::Id> splittedPath;
+    StringInterner::splitPath(qualifiedName, splittedPath);
+    bool isPlainName = qualifiedName.find('/') == std::string::npos;
 
     // Clean splitted path by removing extra slashes and resolving internal . and .. elements where possible. As a
     // result, no "." element may occur, and ".." can only occur at the beginning.
-    for(auto& pathElement : splittedPath) {
-      if(pathElement.size() == 0) continue;
-      if(pathElement == "." && splittedPath.size() != 1) continue;
-      if(pathElement == ".." && _splittedPath.size() > 0 && _splittedPath.back() != "..") {
+    for(auto pathElement : splittedPath) {
+      if(pathElement == StringInterner::dot && !isPlainName) continue;
+      if(pathElement == StringInterner::dotDot && _splittedPath.size() > 0 &&
+          _splittedPath.back() != StringInterner::dotDot) {
         _splittedPath.pop_back();
         continue;
       }
-      if(pathElement == ".." && moveToRoot) {
+      if(pathElement == StringInterner::dotDot && moveToRoot) {
         throw ChimeraTK::logic_error("QualifiedName of HierarchyModifyingGroup must not start with '/..'!");
       }
       _splittedPath.push_back(pathElement);
     }
 
     // Change name to last element of cleaned path
-    _name = _splittedPath.back();
+    _name = StringInterner::get(_splittedPath.back());
   }
 
   /********************************************************************************************************************/
@@ -77,13 +76,13 @@ namespace ChimeraTK {
         // the first hierarchy is already eliminated by directly using the original function in this case
         eliminateFirstHierarchy = false;
       }
-      if(_splittedPath.size() == 1 && _splittedPath.front() == "..") {
+      if(_splittedPath.size() == 1 && _splittedPath.front() == StringInterner::dotDot) {
         assert(!moveToRoot);
         eliminateFirstHierarchy = true;
         currentVirtualParent = dynamic_cast<VirtualModule*>(currentVirtualParent->getOwner());
         assert(currentVirtualParent != nullptr);
       }
-      if(_splittedPath.size() == 1 && _splittedPath.front() == ".") {
+      if(_splittedPath.size() == 1 && _splittedPath.front() == StringInterner::dot) {
         assert(!moveToRoot);
         eliminateFirstHierarchy = true;
       }
@@ -95,7 +94,7 @@ namespace ChimeraTK {
     // Create virtual ownership tree.
     // At this point, there is always at least one extra VirtualModule to be created.
     size_t index = 0;
-    for(auto& pathElement : _splittedPath) {
+    for(auto pathElement : _splittedPath) {
       ++index;
 
       // Last element: create and fill through original base class implementation
@@ -105,7 +104,7 @@ namespace ChimeraTK {
       }
 
       // ".." element (only appearing at the beginning due to cleaning in constructor): move parent one level higher
-      if(pathElement == "..") {
+      if(pathElement == StringInterner::dotDot) {
         currentVirtualParent = dynamic_cast<VirtualModule*>(currentVirtualParent->getOwner());
         assert(currentVirtualParent != nullptr);
         continue;
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "IntrospectionServer.h"
+
+#include "Application.h"
+#include "DeviceModule.h"
+#include "MetaDataPropagatingRegisterDecorator.h"
+#include "VariableNetworkNode.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  namespace {
+
+    std::string recoveryStateName(DeviceModule::RecoveryState state) {
+      switch(state) {
+        case DeviceModule::RecoveryState::opening:
+          return "opening";
+        case DeviceModule::RecoveryState::initialising:
+          return "initialising";
+        case DeviceModule::RecoveryState::writingRecoveryValues:
+          return "writingRecoveryValues";
+        case DeviceModule::RecoveryState::functional:
+          return "functional";
+        case DeviceModule::RecoveryState::waitingForTransfers:
+          return "waitingForTransfers";
+      }
+      return "unknown"; // LCOV_EXCL_LINE (assert-like)
+    }
+
+  } // namespace
+
+  /********************************************************************************************************************/
+
+  IntrospectionServer::IntrospectionServer(Application& application, const std::string& socketPath)
+  : _application(application), _socketPath(socketPath) {
+    // collect the application variables. This is done only once, the networks do not change after initialisation.
+    auto addVariable = [&](const VariableNetworkNode& node) {
+      if(node.getType() != NodeType::Application) return;
+      auto element = node.getAppAccessorNoType().getHighLevelImplElement();
+      auto flagProvider = boost::dynamic_pointer_cast<MetaDataPropagationFlagProvider>(element);
+      if(!flagProvider) return;
+      _variables.push_back({element, flagProvider.get()});
+    };
+    for(auto& network : _application.networkList) {
+      if(network.hasFeedingNode()) addVariable(network.getFeedingNode());
+      for(auto& consumer : network.getConsumingNodes()) addVariable(consumer);
+    }
+
+    // create the socket
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if(_socketPath.size() >= sizeof(address.sun_path)) {
+      throw ChimeraTK::runtime_error("Introspection socket path too long: " + _socketPath);
+    }
+    std::strncpy(address.sun_path, _socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    _socket = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if(_socket < 0) {
+      throw ChimeraTK::runtime_error("Cannot create introspection socket: " + std::string(std::strerror(errno)));
+    }
+    ::unlink(_socketPath.c_str()); // remove a stale socket from a previous run
+    if(::bind(_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::chmod(_socketPath.c_str(), S_IRUSR | S_IWUSR) != 0 || ::listen(_socket, 4) != 0) {
+      std::string error = std::strerror(errno);
+      ::close(_socket);
+      throw ChimeraTK::runtime_error("Cannot listen on introspection socket " + _socketPath + ": " + error);
+    }
+
+    _thread = Application::createThread([this] { serve(); });
+  }
+
+  /********************************************************************************************************************/
+
+  IntrospectionServer::~IntrospectionServer() {
+    _thread.interrupt();
+    _thread.join();
+    ::close(_socket);
+    ::unlink(_socketPath.c_str());
+  }
+
+  /********************************************************************************************************************/
+
+  void IntrospectionServer::serve() {
+    Application::registerThread("Introspection");
+    while(true) {
+      pollfd request{_socket, POLLIN, 0};
+      int ready = ::poll(&request, 1, 100);
+      boost::this_thread::interruption_point();
+      if(ready <= 0) continue;
+
+      int client = ::accept4(_socket, nullptr, nullptr, SOCK_CLOEXEC);
+      if(client < 0) continue;
+      std::string data = report();
+      size_t sent = 0;
+      while(sent < data.size()) {
+        auto n = ::send(client, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if(n <= 0) break;
+        sent += size_t(n);
+      }
+      ::close(client);
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  std::string IntrospectionServer::report() {
+    std::stringstream out;
+
+    out << "# threads: name, variable waited for in a blocking read" << std::endl;
+    // The list is protected by a mutex which is only taken when registering threads, so this does not interfere with
+    // the application.
+    for(auto& thread : _application.getThreadStatusList()) {
+      auto* blockedOn = thread->blockedOn.load(std::memory_order_relaxed);
+      auto blockedOnGroup = std::atomic_load(&thread->blockedOnGroup);
+      out << thread->name << "\t"
+          << (blockedOn ? blockedOn->getQualifiedName() : (blockedOnGroup ? *blockedOnGroup : "-")) << std::endl;
+    }
+
+    out << "# thread stacks: name, stack size [bytes], high-water mark [bytes]" << std::endl;
+    for(auto& usage : _application.getThreadStackUsage()) {
+      out << usage.name << "\t" << usage.stackSize << "\t" << usage.highWaterMark << std::endl;
+    }
+
+    out << "# variables: name, queue fill level, last version time [ns since epoch], transfers, validity" << std::endl;
+    for(auto& variable : _variables) {
+      auto* v = variable.flagProvider;
+      out << v->getQualifiedName() << "\t" << v->getQueueFillLevel() << "\t" << v->getLastVersionTime() << "\t"
+          << v->getTransferCount() << "\t" << (v->getLastValidity() == DataValidity::ok ? "ok" : "faulty")
+          << std::endl;
+    }
+
+    out << "# devices: alias or CDD, recovery state, number of exceptions" << std::endl;
+    for(auto& device : _application.deviceModuleMap) {
+      out << device.first << "\t" << recoveryStateName(device.second->getRecoveryState()) << "\t"
+          << device.second->getExceptionCount() << std::endl;
+    }
+
+    return out.str();
+  }
+
+  /********************************************************************************************************************/
+
+} /* namespace ChimeraTK */
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "MemoryLocking.h"
+
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  namespace {
+    /** Guard pages of thread stacks are at most this large */
+    constexpr uintptr_t maximumGuardSize = 1024 * 1024;
+  } // namespace
+
+  /********************************************************************************************************************/
+
+  std::vector<MemoryLocking::Region> MemoryLocking::findLargeAnonymousRegions(
+      std::istream& maps, size_t minimumSize) {
+    std::vector<Region> regions;
+    Region previous{0, 0};
+    bool previousIsGuard = false;
+
+    std::string line;
+    while(std::getline(maps, line)) {
+      // format: begin-end perms offset dev inode [path]
+      std::istringstream fields(line);
+      std::string range, perms, offset, device, inode, path;
+      fields >> range >> perms >> offset >> device >> inode;
+      std::getline(fields >> std::ws, path);
+      auto dash = range.find('-');
+      if(dash == std::string::npos || perms.size() < 4) continue;
+      Region region{std::stoull(range.substr(0, dash), nullptr, 16), std::stoull(range.substr(dash + 1), nullptr, 16)};
+
+      bool isAnonymous = path.empty() || path == "[heap]";
+      bool isPrivateWritable = perms[0] == 'r' && perms[1] == 'w' && perms[3] == 'p';
+      bool followsGuard = previousIsGuard && previous.end == region.begin;
+      if(isAnonymous && isPrivateWritable && !followsGuard && region.end - region.begin >= minimumSize) {
+        regions.push_back(region);
+      }
+
+      previousIsGuard = perms.compare(0, 3, "---") == 0 && region.end - region.begin <= maximumGuardSize;
+      previous = region;
+    }
+    return regions;
+  }
+
+  /********************************************************************************************************************/
+
+  size_t MemoryLocking::getHugePageSize() {
+    std::ifstream enabled("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string mode;
+    std::getline(enabled, mode);
+    // the active mode is put in brackets, e.g. "always [madvise] never"
+    if(!enabled || mode.find("[never]") != std::string::npos) return 0;
+
+    std::ifstream sizeFile("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+    size_t size = 0;
+    sizeFile >> size;
+    return sizeFile ? size : 2 * 1024 * 1024;
+  }
+
+  /********************************************************************************************************************/
+
+  size_t MemoryLocking::adviseHugePages(const std::vector<Region>& regions, size_t hugePageSize) {
+    size_t advised = 0;
+    for(auto& region : regions) {
+      uintptr_t begin = (region.begin + hugePageSize - 1) / hugePageSize * hugePageSize;
+      uintptr_t end = region.end / hugePageSize * hugePageSize;
+      if(end <= begin) continue;
+      auto* address = reinterpret_cast<void*>(begin);
+      if(madvise(address, end - begin, MADV_HUGEPAGE) != 0) continue;
+#ifdef MADV_COLLAPSE
+      // The buffers have already been faulted in with small pages. Collapse them now instead of waiting for
+      // khugepaged. Not supported by older kernels, in which case khugepaged will do it eventually.
+      (void)madvise(address, end - begin, MADV_COLLAPSE);
+#endif
+      advised += end - begin;
+    }
+    return advised;
+  }
+
+  /********************************************************************************************************************/
+
+  bool MemoryLocking::lockCurrent(std::string& error) {
+    if(mlockall(MCL_CURRENT) != 0) {
+      error = std::strerror(errno);
+      return false;
+    }
+    return true;
+  }
+
+  /********************************************************************************************************************/
+
+  bool MemoryLocking::lockOnFault(std::string& error) {
+#ifdef MCL_ONFAULT
+    if(mlockall(MCL_CURRENT | MCL_FUTURE | MCL_ONFAULT) != 0) {
+      error = std::strerror(errno);
+      return false;
+    }
+    return true;
+#else
+    error = "MCL_ONFAULT is not supported";
+    return false;
+#endif
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
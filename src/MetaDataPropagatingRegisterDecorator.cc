@@ -4,20 +4,54 @@
 
 #include "Application.h"
 #include "EntityOwner.h"
+#include "IntrospectionServer.h"
+#include "Module.h"
 #include "VariableNetworkNode.h"
 
 #include <boost/pointer_cast.hpp>
 
 namespace ChimeraTK {
 
+  template<typename T>
+  MetaDataPropagatingRegisterDecorator<T>::MetaDataPropagatingRegisterDecorator(
+      const boost::shared_ptr<NDRegisterAccessor<T>>& target, EntityOwner* owner, std::chrono::nanoseconds readSpinTime)
+  : NDRegisterAccessorDecorator<T, T>(target), _owner(owner),
+    _isPushType(target->getAccessModeFlags().has(AccessMode::wait_for_new_data)) {
+    auto* module = dynamic_cast<Module*>(owner);
+    if(module != nullptr) _applicationModule = module->findApplicationModule();
+    if(readSpinTime.count() > 0) {
+      assert(_isPushType);
+      _spinWait.emplace(readSpinTime);
+      _targetQueue = target->getReadQueue();
+    }
+  }
+
+  template<typename T>
+  void MetaDataPropagatingRegisterDecorator<T>::doPreRead(TransferType type) {
+    if(type == TransferType::read && _isPushType) {
+      // only blocking reads can benefit from spinning
+      if(_spinWait) _spinWait->wait(_targetQueue);
+      // let the IntrospectionServer know which variable we are (potentially) blocking on
+      if(detail::currentThreadStatus) detail::currentThreadStatus->blockedOn.store(this, std::memory_order_relaxed);
+    }
+    NDRegisterAccessorDecorator<T, T>::doPreRead(type);
+  }
+
   template<typename T>
   void MetaDataPropagatingRegisterDecorator<T>::doPostRead(TransferType type, bool hasNewData) {
+    if(type == TransferType::read && detail::currentThreadStatus) {
+      detail::currentThreadStatus->blockedOn.store(nullptr, std::memory_order_relaxed);
+    }
+
+    if(hasNewData && _spinWait) _spinWait->arrived();
+
     NDRegisterAccessorDecorator<T, T>::doPostRead(type, hasNewData);
 
     // update the version number
-    if(_target->getAccessModeFlags().has(AccessMode::wait_for_new_data) && type == TransferType::read) {
+    if(_isPushType && type == TransferType::read) {
       _owner->setCurrentVersionNumber(this->getVersionNumber());
     }
+    if(hasNewData) countTransfer(this->getVersionNumber());
 
     // Check if the data validity flag changed. If yes, propagate this information to the owning module and the application
     if(_dataValidity != lastValidity) {
@@ -70,6 +104,27 @@ namespace ChimeraTK {
     _target->preWrite(type, versionNumber);
   }
 
+  template<typename T>
+  void MetaDataPropagatingRegisterDecorator<T>::doPostWrite(TransferType type, VersionNumber versionNumber) {
+    NDRegisterAccessorDecorator<T, T>::doPostWrite(type, versionNumber);
+
+    // only count writes which have not thrown
+    countTransfer(versionNumber);
+
+    // The first write after the owning ApplicationModule has entered its mainLoop() publishes the initial value
+    if(!_initialValuePublished.load(std::memory_order_relaxed) && _applicationModule != nullptr &&
+        _applicationModule->hasReachedTestableMode()) {
+      _initialValuePublished.store(true, std::memory_order_release);
+      Application::getInstance().notifyInitialValuePublished();
+    }
+  }
+
+  template<typename T>
+  size_t MetaDataPropagatingRegisterDecorator<T>::getQueueFillLevel() {
+    if(!_isPushType || !_target->isReadable()) return 0;
+    return this->_readQueue.read_available();
+  }
+
 } // namespace ChimeraTK
 
 INSTANTIATE_TEMPLATE_FOR_CHIMERATK_USER_TYPES(ChimeraTK::MetaDataPropagatingRegisterDecorator);
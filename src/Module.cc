@@ -53,6 +53,7 @@ namespace ChimeraTK {
     ChimeraTK::ReadAnyGroup group;
     for(auto& accessor : recursiveAccessorList) {
       if(accessor.getDirection() == VariableDirection{VariableDirection::feeding, false}) continue;
+      if(accessor.isFoldedConstant()) continue;
       group.add(accessor.getAppAccessorNoType());
     }
 
@@ -62,6 +63,29 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
+  ChimeraTK::CoalescingReadAnyGroup Module::coalescingReadAnyGroup() {
+    auto recursiveAccessorList = getAccessorListRecursive();
+
+    ChimeraTK::CoalescingReadAnyGroup group;
+    for(auto& accessor : recursiveAccessorList) {
+      if(accessor.getDirection() == VariableDirection{VariableDirection::feeding, false}) continue;
+      if(accessor.isFoldedConstant()) continue;
+      group.add(accessor.getAppAccessorNoType());
+    }
+
+    group.finalise();
+
+    // use the read spin time of the ApplicationModule. Spinning is disabled in testable mode, like for single reads.
+    if((getModuleType() == ModuleType::ApplicationModule || getModuleType() == ModuleType::VariableGroup) &&
+        !Application::getInstance().isTestableModeEnabled()) {
+      auto* applicationModule = dynamic_cast<ApplicationModule*>(findApplicationModule());
+      if(applicationModule != nullptr) group.setReadSpinTime(applicationModule->getReadSpinTime());
+    }
+    return group;
+  }
+
+  /*********************************************************************************************************************/
+
   void Module::readAll(bool includeReturnChannels) {
     auto recursiveAccessorList = getAccessorListRecursive();
     // first blockingly read all push-type variables
@@ -73,6 +97,7 @@ namespace ChimeraTK {
       else {
         if(accessor.getDirection().dir != VariableDirection::consuming) continue;
       }
+      if(accessor.isFoldedConstant()) continue;
       accessor.getAppAccessorNoType().read();
     }
     // next non-blockingly read the latest values of all poll-type variables
@@ -80,6 +105,7 @@ namespace ChimeraTK {
       if(accessor.getMode() == UpdateMode::push) continue;
       // poll-type accessors cannot have a readback channel
       if(accessor.getDirection().dir != VariableDirection::consuming) continue;
+      if(accessor.isFoldedConstant()) continue;
       accessor.getAppAccessorNoType().readLatest();
     }
   }
@@ -96,12 +122,14 @@ namespace ChimeraTK {
       else {
         if(accessor.getDirection().dir != VariableDirection::consuming) continue;
       }
+      if(accessor.isFoldedConstant()) continue;
       accessor.getAppAccessorNoType().readNonBlocking();
     }
     for(auto& accessor : recursiveAccessorList) {
       if(accessor.getMode() == UpdateMode::push) continue;
       // poll-type accessors cannot have a readback channel
       if(accessor.getDirection().dir != VariableDirection::consuming) continue;
+      if(accessor.isFoldedConstant()) continue;
       accessor.getAppAccessorNoType().readLatest();
     }
   }
@@ -117,6 +145,7 @@ namespace ChimeraTK {
       else {
         if(accessor.getDirection().dir != VariableDirection::consuming) continue;
       }
+      if(accessor.isFoldedConstant()) continue;
       accessor.getAppAccessorNoType().readLatest();
     }
   }
@@ -274,10 +303,4 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
-  std::list<EntityOwner*> Module::getInputModulesRecursively(std::list<EntityOwner*> startList) {
-    return _owner->getInputModulesRecursively(startList);
-  }
-
-  /*********************************************************************************************************************/
-
 } /* namespace ChimeraTK */
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "StringInterner.h"
+
+#include <cassert>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  namespace {
+
+    struct InternerTable {
+      InternerTable() {
+        add(".");
+        add("..");
+      }
+
+      StringInterner::Id add(std::string_view string) {
+        // the deque never moves its elements, so the keys of the map (views into the stored strings) stay valid
+        auto id = StringInterner::Id(strings.size());
+        strings.emplace_back(string);
+        ids.emplace(strings.back(), id);
+        return id;
+      }
+
+      std::mutex mutex;
+      std::deque<std::string> strings;
+      std::unordered_map<std::string_view, StringInterner::Id> ids;
+    };
+
+    InternerTable& getTable() {
+      static InternerTable table;
+      return table;
+    }
+
+  } // namespace
+
+  /********************************************************************************************************************/
+
+  StringInterner::Id StringInterner::intern(std::string_view string) {
+    auto& table = getTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.ids.find(string);
+    if(it != table.ids.end()) return it->second;
+    return table.add(string);
+  }
+
+  /********************************************************************************************************************/
+
+  const std::string& StringInterner::get(Id id) {
+    auto& table = getTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    assert(id < table.strings.size());
+    return table.strings[id];
+  }
+
+  /********************************************************************************************************************/
+
+  void StringInterner::splitPath(std::string_view path, std::vector<Id>& segments) {
+    size_t begin = 0;
+    while(begin < path.size()) {
+      auto end = path.find('/', begin);
+      if(end == std::string_view::npos) end = path.size();
+      if(end > begin) segments.push_back(intern(path.substr(begin, end - begin)));
+      begin = end + 1;
+    }
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "ThreadStack.h"
+
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  namespace {
+    /** Pattern written to the unused part of the stack */
+    constexpr uint64_t stackPattern = 0xC7A5C7A5C7A5C7A5ULL;
+
+    /** Distance to the current stack pointer which is left untouched by paintUnused(), to protect the frames of the
+     *  painting function itself and the red zone */
+    constexpr uintptr_t paintMargin = 4096;
+
+    uintptr_t pageSize() {
+      static const auto size = uintptr_t(sysconf(_SC_PAGESIZE));
+      return size;
+    }
+
+    /** Residency of the pages of the given page-aligned range */
+    std::vector<unsigned char> residentPages(uintptr_t begin, uintptr_t end) {
+      std::vector<unsigned char> resident((end - begin) / pageSize(), 0);
+      if(!resident.empty() && mincore(reinterpret_cast<void*>(begin), end - begin, resident.data()) != 0) {
+        std::fill(resident.begin(), resident.end(), 0);
+      }
+      return resident;
+    }
+  } // namespace
+
+  /********************************************************************************************************************/
+
+  void ThreadStack::setAttributes(boost::thread::attributes& attributes, size_t stackSize, size_t guardSize) {
+    if(stackSize > 0) {
+      stackSize = std::max(stackSize, size_t(PTHREAD_STACK_MIN));
+      stackSize = (stackSize + pageSize() - 1) / pageSize() * pageSize();
+      attributes.set_stack_size(stackSize);
+    }
+    if(guardSize > 0) {
+      pthread_attr_setguardsize(attributes.native_handle(), (guardSize + pageSize() - 1) / pageSize() * pageSize());
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  bool ThreadStack::getCurrentBounds(Bounds& bounds) {
+    // The stack of the main thread is grown on demand, its size is not fixed.
+    if(getpid() == pid_t(syscall(SYS_gettid))) return false;
+
+    pthread_attr_t attributes;
+    if(pthread_getattr_np(pthread_self(), &attributes) != 0) return false;
+    void* address;
+    size_t size;
+    bool success = pthread_attr_getstack(&attributes, &address, &size) == 0;
+    pthread_attr_destroy(&attributes);
+    if(!success) return false;
+
+    bounds.begin = reinterpret_cast<uintptr_t>(address);
+    bounds.end = bounds.begin + size;
+    return true;
+  }
+
+  /********************************************************************************************************************/
+
+  __attribute__((noinline)) void ThreadStack::paintUnused(const Bounds& bounds) {
+    auto stackPointer = reinterpret_cast<uintptr_t>(__builtin_frame_address(0));
+    if(stackPointer < bounds.begin + paintMargin || stackPointer > bounds.end) return;
+    auto paintEnd = (stackPointer - paintMargin) / pageSize() * pageSize();
+    auto paintBegin = (bounds.begin + pageSize() - 1) / pageSize() * pageSize();
+    if(paintEnd <= paintBegin) return;
+
+    auto resident = residentPages(paintBegin, paintEnd);
+    for(size_t i = 0; i < resident.size(); ++i) {
+      if(!(resident[i] & 1)) continue;
+      auto* page = reinterpret_cast<volatile uint64_t*>(paintBegin + i * pageSize());
+      for(size_t k = 0; k < pageSize() / sizeof(uint64_t); ++k) page[k] = stackPattern;
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  size_t ThreadStack::getHighWaterMark(const Bounds& bounds) {
+    auto begin = (bounds.begin + pageSize() - 1) / pageSize() * pageSize();
+    auto end = bounds.end / pageSize() * pageSize();
+    if(end <= begin) return 0;
+
+    // Search the lowest resident page, then the lowest word in it which does not contain the pattern. The pages of a
+    // stack are used contiguously from the top, so this is the deepest position the stack has ever reached.
+    auto resident = residentPages(begin, end);
+    for(size_t i = 0; i < resident.size(); ++i) {
+      if(!(resident[i] & 1)) continue;
+      auto* page = reinterpret_cast<const volatile uint64_t*>(begin + i * pageSize());
+      for(size_t k = 0; k < pageSize() / sizeof(uint64_t); ++k) {
+        if(page[k] != stackPattern) return bounds.end - reinterpret_cast<uintptr_t>(&page[k]);
+      }
+    }
+    return 0;
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
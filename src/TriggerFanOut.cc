@@ -3,6 +3,10 @@
 
 #include "TriggerFanOut.h"
 
+#include <chrono>
+#include <functional>
+#include <set>
+
 namespace ChimeraTK {
 
   /********************************************************************************************************************/
@@ -21,7 +25,7 @@ namespace ChimeraTK {
 
   void TriggerFanOut::activate() {
     assert(!_thread.joinable());
-    _thread = boost::thread([this] { this->run(); });
+    _thread = Application::createThread([this] { this->run(); });
   }
 
   /********************************************************************************************************************/
@@ -39,10 +43,20 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  void TriggerFanOut::setOverrunPolicy(TriggerOverrunPolicy policy, detail::TriggerStatistics* statistics) {
+    assert(!_thread.joinable());
+    // Overruns can only be detected if the trigger has a queue which can be checked for more triggers
+    _detectOverruns = externalTrigger->getAccessModeFlags().has(AccessMode::wait_for_new_data);
+    _overrunPolicy = policy;
+    _statistics = statistics;
+  }
+
+  /********************************************************************************************************************/
+
   namespace {
     struct SendDataToConsumers {
-      SendDataToConsumers(VersionNumber version, DataValidity triggerValidity)
-      : _version(version), _triggerValidity(triggerValidity) {}
+      SendDataToConsumers(VersionNumber version, DataValidity triggerValidity, ModulePriority priority)
+      : _version(version), _triggerValidity(triggerValidity), _priority(priority) {}
 
       template<typename PAIR>
       void operator()(PAIR& pair) const {
@@ -53,6 +67,8 @@ namespace ChimeraTK {
         for(auto& network : theMap) {
           auto feeder = network.first;
           auto fanOut = network.second;
+          // only send to networks of the priority class of the current pass
+          if(fanOut->getHighestSlavePriority() != _priority) continue;
           fanOut->setDataValidity((_triggerValidity == DataValidity::ok && feeder->dataValidity() == DataValidity::ok) ?
                   DataValidity::ok :
                   DataValidity::faulty);
@@ -68,6 +84,20 @@ namespace ChimeraTK {
 
       VersionNumber _version;
       DataValidity _triggerValidity;
+      ModulePriority _priority;
+    };
+
+    /******************************************************************************************************************/
+
+    struct CollectPriorities {
+      CollectPriorities(std::set<ModulePriority, std::greater<>>& priorities) : _priorities(priorities) {}
+
+      template<typename PAIR>
+      void operator()(PAIR& pair) const {
+        for(auto& network : pair.second) _priorities.insert(network.second->getHighestSlavePriority());
+      }
+
+      std::set<ModulePriority, std::greater<>>& _priorities;
     };
   } // namespace
 
@@ -75,6 +105,23 @@ namespace ChimeraTK {
 
   void TriggerFanOut::run() {
     Application::registerThread("TrFO" + externalTrigger->getName());
+
+    // Networks are served in passes per priority class, highest first, so consumers of high priority are woken up
+    // before all others. Usually all consumers have normal priority, in which case there is only a single pass.
+    std::set<ModulePriority, std::greater<>> priorities;
+    boost::fusion::for_each(fanOutMap.table, CollectPriorities(priorities));
+    if(!priorities.empty()) Application::setThreadPriority(*priorities.begin());
+
+    if(_statistics) {
+      _cycleDuration = boost::dynamic_pointer_cast<NDRegisterAccessor<double>>(
+          _statistics->cycleDuration.getHighLevelImplElement());
+      _nOverruns = boost::dynamic_pointer_cast<NDRegisterAccessor<uint64_t>>(
+          _statistics->nOverruns.getHighLevelImplElement());
+      _nSkippedTriggers = boost::dynamic_pointer_cast<NDRegisterAccessor<uint64_t>>(
+          _statistics->nSkippedTriggers.getHighLevelImplElement());
+      assert(_cycleDuration && _nOverruns && _nSkippedTriggers);
+    }
+
     Application::testableModeLock("start");
     testableModeReached = true;
 
@@ -97,13 +144,37 @@ namespace ChimeraTK {
     if(Application::getInstance().testableMode) --Application::getInstance().testableMode_deviceInitialisationCounter;
 
     while(true) {
+      auto cycleStart = std::chrono::steady_clock::now();
       transferGroup.read();
       // send the version number to the consumers
-      boost::fusion::for_each(fanOutMap.table, SendDataToConsumers(version, externalTrigger->dataValidity()));
+      for(auto priority : priorities) {
+        boost::fusion::for_each(
+            fanOutMap.table, SendDataToConsumers(version, externalTrigger->dataValidity(), priority));
+      }
 
       // wait for external trigger
       boost::this_thread::interruption_point();
-      externalTrigger->read();
+
+      // If the next trigger has arrived already while processing the current one, the trigger is overrun. Depending on
+      // the policy, either process that trigger next or discard all queued triggers except for the newest.
+      bool overrun = _detectOverruns && externalTrigger->readNonBlocking();
+      if(overrun) {
+        ++_overrunCounter;
+        if(_overrunPolicy == TriggerOverrunPolicy::skipStale) {
+          while(externalTrigger->readNonBlocking()) ++_skippedTriggerCounter;
+        }
+      }
+      if(_cycleDuration) {
+        std::chrono::duration<double, std::milli> cycleDuration = std::chrono::steady_clock::now() - cycleStart;
+        _cycleDuration->accessData(0) = cycleDuration.count();
+        _cycleDuration->write(version);
+        _nOverruns->accessData(0) = _overrunCounter;
+        _nOverruns->write(version);
+        _nSkippedTriggers->accessData(0) = _skippedTriggerCounter;
+        _nSkippedTriggers->write(version);
+      }
+
+      if(!overrun) externalTrigger->read();
       boost::this_thread::interruption_point();
       version = externalTrigger->getVersionNumber();
     }
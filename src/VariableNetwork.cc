@@ -5,23 +5,19 @@
 #include "Application.h"
 #include "VariableNetworkDumpingVisitor.h"
 
+#include <algorithm>
 #include <sstream>
 
 namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
-  bool VariableNetwork::hasFeedingNode() const {
-    auto n = std::count_if(nodeList.begin(), nodeList.end(),
-        [](const VariableNetworkNode node) { return node.getDirection().dir == VariableDirection::feeding; });
-    assert(n < 2);
-    return n == 1;
-  }
-
-  /*********************************************************************************************************************/
-
-  size_t VariableNetwork::countConsumingNodes() const {
-    return nodeList.size() - (hasFeedingNode() ? 1 : 0);
+  void VariableNetwork::addConsumer(const VariableNetworkNode& node, size_t position) {
+    assert(node.getDirection().dir != VariableDirection::feeding);
+    assert(position <= _consumers.size());
+    _consumers.insert(_consumers.begin() + std::ptrdiff_t(position), node);
+    if(position < _feederPosition && hasFeedingNode()) ++_feederPosition;
+    if(node.getType() == NodeType::Application) ++_nApplicationConsumers;
   }
 
   /*********************************************************************************************************************/
@@ -39,8 +35,12 @@ namespace ChimeraTK {
       if(hasFeedingNode()) {
         // check if current feeding node is a control system variable: if yes,
         // switch it to consuming
-        if(getFeedingNode().getType() == NodeType::ControlSystem) {
-          getFeedingNode().setDirection({VariableDirection::consuming, false});
+        if(_feeder.getType() == NodeType::ControlSystem) {
+          // keep the node at the position where it was added
+          VariableNetworkNode oldFeeder = _feeder;
+          _feeder = VariableNetworkNode();
+          oldFeeder.setDirection({VariableDirection::consuming, false});
+          addConsumer(oldFeeder, _feederPosition);
         }
         // Current feeder cannot be switch to consumer: throw exception
         else {
@@ -60,32 +60,43 @@ namespace ChimeraTK {
       if(a.getValueType() != typeid(AnyType)) valueType = &(a.getValueType());
       if(a.getUnit() != ChimeraTK::TransferElement::unitNotSet) engineeringUnit = a.getUnit();
       if(a.getDescription() != "") description = a.getDescription();
+      _feeder = a;
+      _feederPosition = _consumers.size();
     }
     else {
       // update value type and engineering unit, if not yet set
       if(valueType == &typeid(AnyType)) valueType = &(a.getValueType());
       if(engineeringUnit == ChimeraTK::TransferElement::unitNotSet) engineeringUnit = a.getUnit();
       if(description == "") description = a.getDescription();
+      addConsumer(a, _consumers.size());
     }
-    // add node to node list
-    nodeList.push_back(a);
   }
 
   /*********************************************************************************************************************/
 
   void VariableNetwork::removeNode(VariableNetworkNode& a) {
-    a.clearOwner();
-    nodeList.remove(a); // this must be done last, since it will destroy the node if it was the last reference.
+    // keep a reference to the node, since a might refer to an element of _consumers
+    VariableNetworkNode node = a;
+    node.clearOwner();
+    if(node == _feeder) {
+      _feeder = VariableNetworkNode();
+      return;
+    }
+    auto it = std::find(_consumers.begin(), _consumers.end(), node);
+    if(it == _consumers.end()) return;
+    if(size_t(it - _consumers.begin()) < _feederPosition) --_feederPosition;
+    if(node.getType() == NodeType::Application) --_nApplicationConsumers;
+    _consumers.erase(it);
   }
 
   /*********************************************************************************************************************/
 
   void VariableNetwork::removeNodeToTrigger(const VariableNetworkNode& nodeToNoLongerTrigger) {
-    for(auto& node : nodeList) {
+    for(auto& node : _consumers) {
       if(node.getType() != NodeType::TriggerReceiver) continue;
       if(node.getNodeToTrigger() == nodeToNoLongerTrigger) {
-        removeNode(node); // Note: node may have been destroyed at this point.
-        break;            // we must leave the loop, since we invalidated the iterators
+        removeNode(node);
+        break; // we must leave the loop, since we invalidated the iterators
       }
     }
   }
@@ -106,7 +117,7 @@ namespace ChimeraTK {
   void VariableNetwork::addNodeToTrigger(VariableNetworkNode& nodeToTrigger) {
     VariableNetworkNode node(nodeToTrigger, 0);
     node.setOwner(this);
-    nodeList.push_back(node);
+    addConsumer(node, _consumers.size());
   }
 
   /*********************************************************************************************************************/
@@ -134,7 +145,7 @@ namespace ChimeraTK {
       return TriggerType::feeder;
     }
     // network is fed by a poll-type node: must have exactly one polling consumer
-    size_t nPollingConsumers = count_if(nodeList.begin(), nodeList.end(), [](const VariableNetworkNode& n) {
+    size_t nPollingConsumers = count_if(_consumers.begin(), _consumers.end(), [](const VariableNetworkNode& n) {
       return n.getDirection().dir == VariableDirection::consuming && n.getMode() == UpdateMode::poll;
     });
     if(nPollingConsumers != 1) {
@@ -194,7 +205,7 @@ namespace ChimeraTK {
 
     // all consumers must have the same length as the feeder or a zero length for
     // trigger receivers
-    for(auto& node : nodeList) {
+    for(auto& node : _consumers) {
       if(node.getType() != NodeType::TriggerReceiver) {
         if(node.getNumberOfElements() != length) {
           std::stringstream msg;
@@ -221,7 +232,7 @@ namespace ChimeraTK {
 
     // all nodes must have this network as the owner and a value type equal the
     // network's value type
-    for(auto& node : nodeList) {
+    auto checkValueType = [&](const VariableNetworkNode& node) {
       assert(&(node.getOwner()) == this);
       if(node.getValueType() == typeid(AnyType)) node.setValueType(*valueType);
       if(node.getValueType() != *valueType) {
@@ -233,7 +244,9 @@ namespace ChimeraTK {
         dump("", msg);
         throw ChimeraTK::logic_error(msg.str());
       }
-    }
+    };
+    checkValueType(_feeder);
+    for(auto& node : _consumers) checkValueType(node);
 
     // if the feeder is an application node, it must be in push mode
     if(getFeedingNode().getType() == NodeType::Application) {
@@ -278,34 +291,14 @@ namespace ChimeraTK {
   /*********************************************************************************************************************/
 
   VariableNetworkNode VariableNetwork::getFeedingNode() const {
-    auto iter = std::find_if(nodeList.begin(), nodeList.end(),
-        [](const VariableNetworkNode& n) { return n.getDirection().dir == VariableDirection::feeding; });
-    if(iter == nodeList.end()) {
+    if(!hasFeedingNode()) {
       std::stringstream msg;
       msg << "No feeding node in this network!" << std::endl;
       msg << "The illegal network:" << std::endl;
       dump("", msg);
       throw ChimeraTK::logic_error(msg.str());
     }
-    return *iter;
-  }
-
-  /*********************************************************************************************************************/
-
-  std::list<VariableNetworkNode> VariableNetwork::getConsumingNodes() const {
-    std::list<VariableNetworkNode> consumers;
-    for(auto& n : nodeList)
-      if(n.getDirection().dir == VariableDirection::consuming) consumers.push_back(n);
-    return consumers;
-  }
-
-  /*********************************************************************************************************************/
-
-  bool VariableNetwork::hasApplicationConsumer() const {
-    for(auto& n : nodeList) {
-      if(n.getDirection().dir == VariableDirection::consuming && n.getType() == NodeType::Application) return true;
-    }
-    return false;
+    return _feeder;
   }
 
   /*********************************************************************************************************************/
@@ -322,7 +315,8 @@ namespace ChimeraTK {
     }
 
     // put all consuming nodes of B's owner into A's owner
-    for(auto& node : other.getConsumingNodes()) {
+    auto otherConsumers = other.getConsumingNodes(); // copy, since removeNode() modifies the list
+    for(auto& node : otherConsumers) {
       other.removeNode(node);
       addNode(node);
     }
@@ -344,7 +338,8 @@ namespace ChimeraTK {
 
   bool VariableNetwork::operator==(const VariableNetwork& other) const {
     if(other.valueType != valueType) return false;
-    if(other.nodeList != nodeList) return false;
+    if(other._feeder != _feeder) return false;
+    if(other._consumers != _consumers) return false;
     return true;
   }
 
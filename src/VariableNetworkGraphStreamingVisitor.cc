@@ -0,0 +1,262 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "VariableNetworkGraphStreamingVisitor.h"
+
+#include "Application.h"
+#include "VariableGroup.h"
+#include "VariableNetwork.h"
+#include "VisitorHelper.h"
+
+#include <typeinfo>
+
+namespace ChimeraTK {
+
+  /*********************************************************************************************************************/
+
+  namespace {
+
+    /** Return the ApplicationModule owning the given node, or nullptr if it is not owned by an ApplicationModule */
+    EntityOwner* getApplicationModule(const VariableNetworkNode& node) {
+      if(node.getType() != NodeType::Application) return nullptr;
+      auto owner = node.getOwningModule();
+      while(owner && owner->getModuleType() == EntityOwner::ModuleType::VariableGroup) {
+        owner = static_cast<VariableGroup*>(owner)->getOwner();
+      }
+      if(!owner || owner->getModuleType() != EntityOwner::ModuleType::ApplicationModule) return nullptr;
+      return owner;
+    }
+
+    /** Call the function for the feeder and all consumers of the network */
+    template<typename FUNCTOR>
+    void forEachNode(const VariableNetwork& network, FUNCTOR function) {
+      if(network.hasFeedingNode()) function(network.getFeedingNode());
+      for(auto& consumer : network.getConsumingNodes()) function(consumer);
+    }
+
+  } // namespace
+
+  /*********************************************************************************************************************/
+
+  VariableNetworkGraphStreamingVisitor::VariableNetworkGraphStreamingVisitor(
+      std::ostream& stream, ConnectionGraphFilter filter)
+  : _stream(stream), _filter(std::move(filter)) {}
+
+  /*********************************************************************************************************************/
+
+  void VariableNetworkGraphStreamingVisitor::dispatch(const Application& t) {
+    selectNetworks(t);
+
+    _stream << "digraph application {\n"
+            << "  fontname=\"Sans\";\n"
+            << "  fontsize=\"10\";\n"
+            << "  labelloc=t;\n"
+            << "  nodesep=1;\n"
+            << "  concentrate=true;\n"
+            << "  label=\"<" << boost::core::demangle(typeid(t).name()) << ">" << t.getName() << "\";\n"
+            << "  node [style=\"filled,rounded\", shape=box, fontsize=\"9\", fontname=\"sans\"];\n"
+            << "  edge [labelfontsize=\"6\", fontsize=\"9\", fontname=\"monospace\"];\n";
+
+    _networkCount = 0;
+    for(auto& network : t.networkList) {
+      if(_selected.empty() || _selected[_networkCount]) network.accept(*this);
+      ++_networkCount;
+    }
+
+    _stream << "}\n";
+  }
+
+  /*********************************************************************************************************************/
+
+  void VariableNetworkGraphStreamingVisitor::selectNetworks(const Application& t) {
+    _selected.clear();
+    if(_filter.modules.empty() && _filter.tags.empty()) return;
+
+    // Matching the qualified names is cached per owner, since many variables share the same owner
+    std::unordered_map<EntityOwner*, bool> ownerMatches;
+    auto matches = [&](const VariableNetworkNode& node) {
+      if(node.getType() != NodeType::Application) return false;
+      for(auto& tag : node.getTags()) {
+        if(_filter.tags.count(tag)) return true;
+      }
+      if(_filter.modules.empty()) return false;
+      auto [it, inserted] = ownerMatches.try_emplace(node.getOwningModule(), false);
+      if(inserted) {
+        auto name = node.getOwningModule()->getQualifiedName();
+        for(auto& module : _filter.modules) {
+          // match the module itself and its submodules, but not other modules with the same name prefix
+          bool isPrefix = name.compare(0, module.size(), module) == 0;
+          if(isPrefix && (name.size() == module.size() || name[module.size()] == '/')) {
+            it->second = true;
+            break;
+          }
+        }
+      }
+      return it->second;
+    };
+
+    // Select the networks matching the filter directly, and collect the modules involved in them
+    _selected.assign(t.networkList.size(), false);
+    std::unordered_set<EntityOwner*> modules;
+    auto collectModule = [](std::unordered_set<EntityOwner*>& set) {
+      return [&set](const VariableNetworkNode& node) {
+        auto module = getApplicationModule(node);
+        if(module) set.insert(module);
+      };
+    };
+    size_t index = 0;
+    for(auto& network : t.networkList) {
+      bool selected = false;
+      forEachNode(network, [&](const VariableNetworkNode& node) { selected = selected || matches(node); });
+      if(selected) {
+        _selected[index] = true;
+        forEachNode(network, collectModule(modules));
+      }
+      ++index;
+    }
+
+    // Add the networks connected to the collected modules, one level of modules per pass
+    for(size_t level = 0; level < _filter.depth; ++level) {
+      std::unordered_set<EntityOwner*> nextModules;
+      index = 0;
+      for(auto& network : t.networkList) {
+        if(!_selected[index]) {
+          bool connected = false;
+          forEachNode(network, [&](const VariableNetworkNode& node) {
+            auto module = getApplicationModule(node);
+            connected = connected || (module && modules.count(module) > 0);
+          });
+          if(connected) {
+            _selected[index] = true;
+            forEachNode(network, collectModule(nextModules));
+          }
+        }
+        ++index;
+      }
+      if(nextModules.empty()) break;
+      modules.insert(nextModules.begin(), nextModules.end());
+    }
+  }
+
+  /*********************************************************************************************************************/
+
+  void VariableNetworkGraphStreamingVisitor::dispatch(const VariableNetwork& network) {
+    std::string prefix = "n" + std::to_string(_networkCount) + "_";
+
+    // Nodes which are shared between networks must be declared on top level, hence before the subgraph is opened.
+    // We are inside a trigger network, if the consumers are TriggerReceivers. They will be skipped below.
+    std::string feeder;
+    std::string trigger;
+    if(network.hasFeedingNode()) {
+      auto feederNode = network.getFeedingNode();
+      if(!network.getConsumingNodes().empty() &&
+          network.getConsumingNodes().front().getType() == NodeType::TriggerReceiver) {
+        feeder = "t" + std::to_string(getTriggerNodeId(feederNode));
+      }
+      if(feederNode.hasExternalTrigger()) {
+        trigger = "t" + std::to_string(getTriggerNodeId(feederNode.getExternalTrigger()));
+      }
+    }
+
+    _stream << "  subgraph cluster_" << prefix << " {\n"
+            << "    fontsize=\"8\";\n"
+            << "    style=\"filled,rounded\";\n"
+            << "    color=black;\n"
+            << "    fillcolor=white;\n"
+            << "    ordering=out;\n"
+            << "    label=\"" << network.getDescription() << "\\n"
+            << "value type = " << boost::core::demangle(network.getValueType().name()) << "\\n"
+            << "engineering unit = " << network.getUnit() << "\";\n";
+
+    if(network.hasFeedingNode() && feeder.empty()) {
+      feeder = prefix + "0";
+      writeNode(feeder, network.getFeedingNode());
+    }
+
+    size_t nConsumers = 0;
+    for(auto& consumerNode : network.getConsumingNodes()) {
+      ++nConsumers;
+      if(consumerNode.getType() == NodeType::TriggerReceiver) continue;
+      auto consumer = prefix + std::to_string(nConsumers);
+      writeNode(consumer, consumerNode);
+      if(feeder.empty()) continue;
+
+      _stream << "    " << feeder << " -> ";
+      if(!trigger.empty()) {
+        // Create trigger connection diamond. The edge from the trigger is added outside the subgraph.
+        _stream << prefix << "h" << nConsumers << " -> " << consumer << "\n"
+                << "    " << prefix << "h" << nConsumers
+                << " [label=\"\",shape=diamond,style=\"filled\",color=black,width=.3,height=.3,fixedsize=true,"
+                   "fillcolor=\"#ffcc00\"]\n";
+      }
+      else {
+        _stream << consumer << "\n";
+      }
+    }
+
+    _stream << "  }\n";
+
+    if(!trigger.empty()) {
+      // Hack: Make trigger lower in rank than all entry points to subgraphs
+      _stream << "  " << trigger << " -> " << feeder << " [style=invis]\n";
+      for(size_t i = 1; i <= nConsumers; ++i) {
+        if(network.getConsumingNodes()[i - 1].getType() == NodeType::TriggerReceiver) continue;
+        _stream << "  " << trigger << " -> " << prefix << "h" << i << " [style=dashed,color=grey,tailport=s]\n";
+      }
+    }
+  }
+
+  /*********************************************************************************************************************/
+
+  size_t VariableNetworkGraphStreamingVisitor::getTriggerNodeId(const VariableNetworkNode& node) {
+    auto [it, inserted] = _triggerNodeIds.try_emplace(detail::nodeName(node), _triggerNodeIds.size());
+    if(inserted) writeNode("t" + std::to_string(it->second), node);
+    return it->second;
+  }
+
+  /*********************************************************************************************************************/
+
+  void VariableNetworkGraphStreamingVisitor::writeNode(const std::string& id, const VariableNetworkNode& node) {
+    _stream << "    " << id << " [fillcolor=\"";
+    if(node.getMode() == UpdateMode::push) {
+      _stream << "#ff9900";
+    }
+    else if(node.getMode() == UpdateMode::poll) {
+      _stream << "#b4d848";
+    }
+    else {
+      _stream << "#ffffff";
+    }
+
+    _stream << "\",label=\"" << detail::nodeName(node) << "\\n";
+    switch(node.getType()) {
+      case NodeType::Application:
+        _stream << "Application";
+        break;
+      case NodeType::ControlSystem:
+        _stream << "ControlSystem";
+        break;
+      case NodeType::Device:
+        _stream << "Device " << node.getDeviceAlias() << ": " << node.getRegisterName();
+        break;
+      case NodeType::TriggerReceiver:
+        _stream << "TriggerReceiver";
+        break;
+      case NodeType::Constant:
+        _stream << "Constant";
+        break;
+      case NodeType::TriggerProvider:
+        _stream << "TriggerProvider";
+        break;
+      case NodeType::invalid:
+        _stream << "**invalid**";
+        break;
+    }
+    if(node.getDirection().withReturn) _stream << ", with return";
+    _stream << "\\nlength: " << node.getNumberOfElements();
+    if(node.isCircularInput()) _stream << "\\ncircular dependency " << node.getCircularNetworkHash();
+    _stream << "\"]\n";
+  }
+
+  /*********************************************************************************************************************/
+
+} // namespace ChimeraTK
@@ -4,15 +4,12 @@
 
 #include "Application.h"
 #include "ApplicationModule.h"
-#include "CircularDependencyDetectionRecursionStopper.h"
 #include "EntityOwner.h"
 #include "VariableGroup.h"
 #include "VariableNetwork.h"
 #include "VariableNetworkNodeDumpingVisitor.h"
 #include "Visitor.h"
 
-#include <boost/container_hash/hash.hpp>
-
 namespace ChimeraTK {
 
   /*********************************************************************************************************************/
@@ -414,58 +411,65 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
-  std::list<EntityOwner*> VariableNetworkNode::scanForCircularDepencency() {
-    // We are starting a new scan. Reset the indicator for already found circular dependencies.
-    detail::CircularDependencyDetectionRecursionStopper::startNewScan();
-
-    // find the feeder of the network
-    auto feeder = getOwner().getFeedingNode();
-    auto feedingModule = feeder.getOwningModule();
-    // CS modules and device modules don't have an owning module. They stop the circle anyway. So if either the feeder
-    // or the receiver (this) don't have an owning module, there is nothing to do here.
-    if(!feedingModule || !getOwningModule()) {
-      return {};
-    }
+  void VariableNetworkNode::setCircularNetworkHash(size_t circularNetworkHash) {
     assert(getDirection().dir == VariableDirection::consuming);
+    pdata->circularNetworkHash = circularNetworkHash;
 
+    // if the entity owner is a variable group we must go up the hierarchy until we find the application module
     auto owningModule = getOwningModule();
-    // if the entity owner is a variable group we must go up the hierarchy until we find the applciation module
     while(owningModule->getModuleType() == EntityOwner::ModuleType::VariableGroup) {
-      auto variableGroup = static_cast<VariableGroup*>(owningModule);
-      owningModule = variableGroup->getOwner();
+      owningModule = static_cast<VariableGroup*>(owningModule)->getOwner();
     }
     assert(owningModule->getModuleType() == EntityOwner::ModuleType::ApplicationModule);
-    auto inputModuleList = feedingModule->getInputModulesRecursively({owningModule});
-
-    auto nInstancesFound = std::count(inputModuleList.begin(), inputModuleList.end(), owningModule);
-    assert(nInstancesFound >= 1); // the start list must not have been deleted in the call
-    // The owning module has been found again when scanning inputs recursively -> There is a circular dependency
-    if(nInstancesFound > 1) {
-      // clean up the circular network we found and return it.
-      inputModuleList.sort();
-      inputModuleList.unique();
-
-      // Remember that we are part of a circle, and of which circle
-      pdata->circularNetworkHash = boost::hash_range(inputModuleList.begin(), inputModuleList.end());
-      // we already did the assertion that the owning module is an application module above, so we can static cast here
-      auto applicationModule = static_cast<ApplicationModule*>(owningModule);
-      applicationModule->setCircularNetworkHash(pdata->circularNetworkHash);
-
-      // Find the MetaDataPropagatingRegisterDecorator which is involed and set the _isCurularInput flag
-      auto internalTargetElements = getAppAccessorNoType().getInternalElements();
-      // This is a list of all the nested decorators, so we will find the right point to cast
-      for(auto& elem : internalTargetElements) {
-        auto flagProvider = boost::dynamic_pointer_cast<MetaDataPropagationFlagProvider>(elem);
-        if(flagProvider) {
-          flagProvider->_isCircularInput = true;
-        }
-      }
+    static_cast<ApplicationModule*>(owningModule)->setCircularNetworkHash(circularNetworkHash);
+
+    // The MetaDataPropagatingRegisterDecorator is the outermost decorator (see setAppAccessorImplementation()), so no
+    // need to search the nested decorators for it.
+    auto flagProvider = boost::dynamic_pointer_cast<MetaDataPropagationFlagProvider>(
+        getAppAccessorNoType().getHighLevelImplElement());
+    assert(flagProvider);
+    flagProvider->_isCircularInput = true;
+  }
+
+  /*********************************************************************************************************************/
+
+  ModulePriority VariableNetworkNode::getPriority() const {
+    if(getType() != NodeType::Application) return ModulePriority::normal;
+
+    auto* module = dynamic_cast<Module*>(getOwningModule());
+    if(module == nullptr) return ModulePriority::normal;
+    auto* applicationModule = dynamic_cast<ApplicationModule*>(module->findApplicationModule());
+    if(applicationModule == nullptr) return ModulePriority::normal;
+    return applicationModule->getPriority();
+  }
+
+  /*********************************************************************************************************************/
+
+  void VariableNetworkNode::setReadSpinTime(std::chrono::nanoseconds maxSpinTime) const {
+    assert(getType() == NodeType::Application);
+    pdata->readSpinTime = maxSpinTime;
+  }
 
-      return inputModuleList;
+  /*********************************************************************************************************************/
+
+  std::chrono::nanoseconds VariableNetworkNode::getReadSpinTime() const {
+    if(getType() != NodeType::Application || getMode() != UpdateMode::push ||
+        getDirection().dir != VariableDirection::consuming || Application::getInstance().isTestableModeEnabled()) {
+      return {};
     }
+    if(pdata->readSpinTime) return *pdata->readSpinTime;
+
+    auto* module = dynamic_cast<Module*>(getOwningModule());
+    if(module == nullptr) return {};
+    auto* applicationModule = dynamic_cast<ApplicationModule*>(module->findApplicationModule());
+    if(applicationModule == nullptr) return {};
+    return applicationModule->getReadSpinTime();
+  }
+
+  /*********************************************************************************************************************/
 
-    // No circlular network. Return an empty list.
-    return {};
+  bool VariableNetworkNode::isFoldedConstant() const {
+    return pdata->foldedConstant;
   }
 
   /*********************************************************************************************************************/
@@ -505,4 +509,11 @@ namespace ChimeraTK {
     return pdata->circularNetworkHash;
   }
 
+  /*********************************************************************************************************************/
+
+  std::shared_ptr<DirtyRange> VariableNetworkNode::getDirtyRange() const {
+    if(!pdata->dirtyRange) pdata->dirtyRange = std::make_shared<DirtyRange>();
+    return pdata->dirtyRange;
+  }
+
 } // namespace ChimeraTK
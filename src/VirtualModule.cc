@@ -40,6 +40,8 @@ namespace ChimeraTK {
   VirtualModule& VirtualModule::operator=(const VirtualModule& other) {
     // move-assign a plain new module
     Module::operator=(VirtualModule(other.getName(), other.getDescription(), other.getModuleType()));
+    // the old submodules are no longer registered, so they must not be found any more
+    submoduleIndex.clear();
     // since moduleList stores plain pointers, we need to regenerate this list
     for(auto& mod : other.submodules) addSubModule(mod); // this creates a copy (call by value)
     accessorList = other.accessorList;
@@ -108,11 +110,13 @@ namespace ChimeraTK {
   /********************************************************************************************************************/
 
   void VirtualModule::addSubModule(VirtualModule module) {
-    if(!hasSubmodule(module.getName())) {
+    auto name = StringInterner::intern(module.getName());
+    if(submoduleIndex.find(name) == submoduleIndex.end()) {
       // Submodule doesn'st exist already: register the given module as a new submodule
       submodules.push_back(module);
       registerModule(&(submodules.back()));
       submodules.back()._owner = this;
+      submoduleIndex[name] = &submodules.back();
     }
     else {
       // Submodule does exist already: copy content into the existing submodule
@@ -131,6 +135,7 @@ namespace ChimeraTK {
   void VirtualModule::removeSubModule(const std::string& name) {
     for(auto module = submodules.begin(); module != submodules.end(); ++module) {
       if(module->getName() == name) {
+        submoduleIndex.erase(StringInterner::intern(name));
         unregisterModule(&*module);
         submodules.erase(module);
         break;
@@ -146,27 +151,31 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  VirtualModule& VirtualModule::createAndGetSubmodule(const RegisterPath& moduleName) {
-    for(auto& sm : submodules) {
-      if(moduleName == sm.getName()) return sm;
-    }
-    addSubModule(VirtualModule(std::string(moduleName).substr(1), getDescription(), getModuleType()));
+  VirtualModule& VirtualModule::createAndGetSubmodule(const std::string& moduleName) {
+    std::string_view name(moduleName);
+    if(!name.empty() && name.front() == '/') name.remove_prefix(1);
+    return createAndGetSubmodule(StringInterner::intern(name));
+  }
+
+  /********************************************************************************************************************/
+
+  VirtualModule& VirtualModule::createAndGetSubmodule(StringInterner::Id moduleName) {
+    auto it = submoduleIndex.find(moduleName);
+    if(it != submoduleIndex.end()) return *it->second;
+    addSubModule(VirtualModule(StringInterner::get(moduleName), getDescription(), getModuleType()));
     return submodules.back();
   }
 
   /********************************************************************************************************************/
 
-  VirtualModule& VirtualModule::createAndGetSubmoduleRecursive(const RegisterPath& moduleName) {
-    if(moduleName == "") return *this;
-    auto slash = std::string(moduleName).find_first_of("/", 1);
-    if(slash == std::string::npos) {
-      return createAndGetSubmodule(moduleName);
-    }
-    else {
-      auto firstSubmodule = std::string(moduleName).substr(0, slash);
-      auto remainingSubmodules = std::string(moduleName).substr(slash + 1);
-      return createAndGetSubmodule(firstSubmodule).createAndGetSubmoduleRecursive(remainingSubmodules);
+  VirtualModule& VirtualModule::createAndGetSubmoduleRecursive(const std::string& moduleName) {
+    std::vector<StringInterner::Id> path;
+    StringInterner::splitPath(moduleName, path);
+    VirtualModule* module = this;
+    for(auto name : path) {
+      module = &module->createAndGetSubmodule(name);
     }
+    return *module;
   }
 
   /********************************************************************************************************************/
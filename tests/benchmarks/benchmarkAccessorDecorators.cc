@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the per-transfer overhead of the decorators on application accessors. A value is written and read
+ * back through an SPSCChannel in a single thread, so only the accessor overhead is measured (no thread wakeup). The
+ * following configurations are compared for scalars and arrays:
+ *  - plain: the undecorated channel
+ *  - stacked: a separate spinning decorator below the MetaDataPropagatingRegisterDecorator, like input accessors with
+ *    a read spin time were decorated before
+ *  - fused: a single MetaDataPropagatingRegisterDecorator with the read spinning enabled
+ */
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "AdaptiveSpinWait.h"
+#include "MetaDataPropagatingRegisterDecorator.h"
+#include "SPSCChannel.h"
+
+#include <ChimeraTK/NDRegisterAccessorDecorator.h>
+#include <ChimeraTK/OneDRegisterAccessor.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace ctk = ChimeraTK;
+using namespace std::chrono_literals;
+
+/*********************************************************************************************************************/
+
+/* Decorator spinning before a blocking read(), as input accessors with a read spin time were decorated before the
+ * spinning was built into the MetaDataPropagatingRegisterDecorator. Only kept here as baseline. */
+class SpinningReadDecorator : public ctk::NDRegisterAccessorDecorator<int64_t> {
+ public:
+  SpinningReadDecorator(
+      const boost::shared_ptr<ctk::NDRegisterAccessor<int64_t>>& target, std::chrono::nanoseconds maxSpinTime)
+  : ctk::NDRegisterAccessorDecorator<int64_t>(target), _spinWait(maxSpinTime), _targetQueue(target->getReadQueue()) {}
+
+  void doPreRead(ctk::TransferType type) override {
+    if(type == ctk::TransferType::read) _spinWait.wait(_targetQueue);
+    ctk::NDRegisterAccessorDecorator<int64_t>::doPreRead(type);
+  }
+
+  void doPostRead(ctk::TransferType type, bool hasNewData) override {
+    if(hasNewData) _spinWait.arrived();
+    ctk::NDRegisterAccessorDecorator<int64_t>::doPostRead(type, hasNewData);
+  }
+
+  const ctk::AdaptiveSpinWait& getSpinWait() const { return _spinWait; }
+
+ protected:
+  ctk::AdaptiveSpinWait _spinWait;
+  cppext::future_queue<void> _targetQueue;
+};
+
+/*********************************************************************************************************************/
+
+struct Owner : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct BenchmarkApplication : public ctk::Application {
+  BenchmarkApplication() : Application("benchmarkAccessorDecorators") {}
+  ~BenchmarkApplication() override { shutdown(); }
+
+  Owner owner{this, "owner", ""};
+};
+
+/*********************************************************************************************************************/
+
+enum class Configuration { plain, stacked, fused };
+
+/*********************************************************************************************************************/
+
+static double measure(ctk::EntityOwner* owner, Configuration configuration, size_t nElements, size_t nIterations) {
+  auto pair = ctk::createSPSCChannel<int64_t>(nElements, "var", "", "", 3, {ctk::AccessMode::wait_for_new_data});
+  boost::shared_ptr<ctk::NDRegisterAccessor<int64_t>> sendingImpl = pair.first, receivingImpl = pair.second;
+  if(configuration == Configuration::stacked) {
+    sendingImpl = boost::make_shared<ctk::MetaDataPropagatingRegisterDecorator<int64_t>>(sendingImpl, owner);
+    receivingImpl = boost::make_shared<SpinningReadDecorator>(receivingImpl, 10us);
+    receivingImpl = boost::make_shared<ctk::MetaDataPropagatingRegisterDecorator<int64_t>>(receivingImpl, owner);
+  }
+  else if(configuration == Configuration::fused) {
+    sendingImpl = boost::make_shared<ctk::MetaDataPropagatingRegisterDecorator<int64_t>>(sendingImpl, owner);
+    receivingImpl = boost::make_shared<ctk::MetaDataPropagatingRegisterDecorator<int64_t>>(receivingImpl, owner, 10us);
+  }
+  ctk::OneDRegisterAccessor<int64_t> sender(sendingImpl), receiver(receivingImpl);
+
+  auto start = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < nIterations; ++i) {
+    sender[0] = int64_t(i);
+    sender.write();
+    receiver.read();
+  }
+  std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+  if(receiver[0] != int64_t(nIterations - 1)) std::cout << "*** Unexpected value received!" << std::endl;
+  return duration.count() / double(nIterations);
+}
+
+/*********************************************************************************************************************/
+
+int main() {
+  BenchmarkApplication app;
+
+  std::cout << std::setw(8) << "length" << std::setw(16) << "plain [ns]" << std::setw(16) << "stacked [ns]"
+            << std::setw(16) << "fused [ns]" << std::endl;
+  for(size_t nElements : {1, 16, 1024}) {
+    size_t nIterations = std::max(size_t(1000), size_t(10000000) / (nElements + 100));
+    std::cout << std::setw(8) << nElements;
+    for(auto configuration : {Configuration::plain, Configuration::stacked, Configuration::fused}) {
+      std::cout << std::setw(16) << measure(&app.owner, configuration, nElements, nIterations);
+    }
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the CoalescingReadAnyGroup in a fan-in topology. A producer thread updates N inputs with the same
+ * version number per trigger (like a trigger distributing device data to a module). The consumer recomputes and writes
+ * its output after each readAny(), using the plain ReadAnyGroup (the current behaviour) and the
+ * CoalescingReadAnyGroup. Measured per trigger: number of computations (= output writes) and consumer CPU time.
+ */
+
+#include "CoalescingReadAnyGroup.h"
+#include "SPSCChannel.h"
+
+#include <ChimeraTK/ScalarRegisterAccessor.h>
+
+#include <time.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+static double threadCpuTime() {
+  timespec ts{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return double(ts.tv_sec) * 1e9 + double(ts.tv_nsec);
+}
+
+/*********************************************************************************************************************/
+
+struct Result {
+  double computationsPerTrigger;
+  double cpuPerTrigger;
+};
+
+/*********************************************************************************************************************/
+
+static Result measure(size_t nInputs, bool coalescing, size_t nTriggers) {
+  std::vector<ctk::ScalarRegisterAccessor<int64_t>> senders, receivers;
+  for(size_t i = 0; i < nInputs; ++i) {
+    auto pair = ctk::createSPSCChannel<int64_t>(
+        1, "input" + std::to_string(i), "", "", 3, {ctk::AccessMode::wait_for_new_data});
+    senders.emplace_back(pair.first);
+    receivers.emplace_back(pair.second);
+  }
+  auto outputPair = ctk::createSPSCChannel<int64_t>(1, "output", "", "", 3, {ctk::AccessMode::wait_for_new_data});
+  ctk::ScalarRegisterAccessor<int64_t> output(outputPair.first);
+  ctk::ScalarRegisterAccessor<int64_t> ack(outputPair.second);
+
+  ctk::ReadAnyGroup plainGroup;
+  ctk::CoalescingReadAnyGroup coalescingGroup;
+  for(auto& receiver : receivers) {
+    plainGroup.add(receiver);
+    coalescingGroup.add(receiver);
+  }
+  plainGroup.finalise();
+  coalescingGroup.finalise();
+
+  // The last input carries the trigger number. The consumer acknowledges each completed trigger through the output,
+  // so the producer never overruns the queues.
+  size_t nComputations = 0;
+  double cpuTime = 0;
+  std::thread consumer([&] {
+    auto cpuStart = threadCpuTime();
+    int64_t lastTrigger = 0;
+    while(lastTrigger < int64_t(nTriggers)) {
+      if(coalescing) {
+        coalescingGroup.readAny();
+      }
+      else {
+        plainGroup.readAny();
+      }
+      int64_t sum = 0;
+      for(auto& receiver : receivers) sum += receiver;
+      ++nComputations;
+      output = sum;
+      if(receivers.back() != lastTrigger) {
+        lastTrigger = receivers.back();
+        output.write();
+      }
+    }
+    cpuTime = threadCpuTime() - cpuStart;
+  });
+
+  for(size_t trigger = 1; trigger <= nTriggers; ++trigger) {
+    ctk::VersionNumber version;
+    for(auto& sender : senders) {
+      sender = int64_t(trigger);
+      sender.write(version);
+    }
+    ack.read();
+  }
+  consumer.join();
+
+  return {double(nComputations) / double(nTriggers), cpuTime / double(nTriggers)};
+}
+
+/*********************************************************************************************************************/
+
+int main() {
+  constexpr size_t nTriggers = 20000;
+
+  std::cout << std::setw(10) << "inputs" << std::setw(14) << "coalescing" << std::setw(24) << "computations/trigger"
+            << std::setw(20) << "CPU/trigger [ns]" << std::endl;
+  for(size_t nInputs : {2, 4, 8, 16}) {
+    for(bool coalescing : {false, true}) {
+      auto result = measure(nInputs, coalescing, nTriggers);
+      std::cout << std::setw(10) << nInputs << std::setw(14) << (coalescing ? "yes" : "no") << std::setw(24)
+                << result.computationsPerTrigger << std::setw(20) << result.cpuPerTrigger << std::endl;
+    }
+  }
+
+  return 0;
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the connection phase of large applications. An application with N outputs, each connected to an
+ * application input and to the control system, is initialised (i.e. all connections are made). The application is
+ * not started.
+ */
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct Producer : public ctk::ApplicationModule {
+  Producer(EntityOwner* owner, const std::string& name, size_t nVariables) : ctk::ApplicationModule(owner, name, "") {
+    for(size_t i = 0; i < nVariables; ++i) outputs.emplace_back(this, "var" + std::to_string(i), "", "");
+  }
+  Producer() { throw; } // work around for gcc bug: constructor must be present but is unused
+
+  std::vector<ctk::ScalarOutput<int32_t>> outputs;
+
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct Consumer : public ctk::ApplicationModule {
+  Consumer(EntityOwner* owner, const std::string& name, size_t nVariables) : ctk::ApplicationModule(owner, name, "") {
+    for(size_t i = 0; i < nVariables; ++i) inputs.emplace_back(this, "var" + std::to_string(i), "", "");
+  }
+  Consumer() { throw; } // work around for gcc bug: constructor must be present but is unused
+
+  std::vector<ctk::ScalarPushInput<int32_t>> inputs;
+
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct BenchmarkApplication : public ctk::Application {
+  explicit BenchmarkApplication(size_t nVariables)
+  : Application("benchmarkConnectionPhase"), producer(this, "producer", nVariables),
+    consumer(this, "consumer", nVariables) {}
+  ~BenchmarkApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    producer.connectTo(consumer);
+    producer.connectTo(cs["data"]);
+  }
+
+  ctk::ControlSystemModule cs;
+  Producer producer;
+  Consumer consumer;
+};
+
+/*********************************************************************************************************************/
+
+int main() {
+  std::cout << std::setw(12) << "variables" << std::setw(20) << "initialise [ms]" << std::endl;
+
+  for(size_t nVariables : {100, 1000, 10000}) {
+    BenchmarkApplication app(nVariables);
+    auto start = std::chrono::steady_clock::now();
+    // creates the PV manager and makes all connections, the application is not started
+    ctk::TestFacility test(false);
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    std::cout << std::setw(12) << nVariables << std::setw(20) << duration.count() << std::endl;
+  }
+
+  return 0;
+}
+
+/*********************************************************************************************************************/
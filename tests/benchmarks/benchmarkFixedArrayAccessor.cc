@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the FixedArrayAccessor. Compares typical control loop code (y = a * x + y) on small arrays accessed
+ * through the regular ArrayOutput and through the FixedArrayOutput. Only the computation on the accessor buffers is
+ * measured, no transfers are performed.
+ */
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "FixedArrayAccessor.h"
+#include "TestFacility.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+template<size_t N>
+struct BenchmarkModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ArrayOutput<float> dynamicX{this, "dynamicX", "", N, ""};
+  ctk::ArrayOutput<float> dynamicY{this, "dynamicY", "", N, ""};
+  ctk::FixedArrayOutput<float, N> fixedX{this, "fixedX", "", ""};
+  ctk::FixedArrayOutput<float, N> fixedY{this, "fixedY", "", ""};
+
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct BenchmarkApplication : public ctk::Application {
+  BenchmarkApplication() : Application("benchmarkFixedArrayAccessor") {}
+  ~BenchmarkApplication() override { shutdown(); }
+
+  BenchmarkModule<4> module4{this, "module4", ""};
+  BenchmarkModule<8> module8{this, "module8", ""};
+  BenchmarkModule<16> module16{this, "module16", ""};
+};
+
+/*********************************************************************************************************************/
+
+template<typename FUNCTOR>
+static double measure(size_t nIterations, FUNCTOR functor) {
+  auto start = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < nIterations; ++i) functor(float(i % 7) * 0.001f);
+  std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+  return duration.count() / double(nIterations);
+}
+
+/*********************************************************************************************************************/
+
+template<size_t N>
+static void run(BenchmarkModule<N>& module) {
+  const size_t nIterations = 100000000 / N;
+  for(size_t i = 0; i < N; ++i) {
+    module.dynamicX[i] = module.fixedX[i] = float(i);
+    module.dynamicY[i] = module.fixedY[i] = 0.f;
+  }
+
+  double dynamic = measure(nIterations, [&](float a) {
+    for(size_t i = 0; i < module.dynamicY.getNElements(); ++i) {
+      module.dynamicY[i] = a * module.dynamicX[i] + module.dynamicY[i];
+    }
+  });
+
+  double fixedIndexed = measure(nIterations, [&](float a) {
+    for(size_t i = 0; i < module.fixedY.size(); ++i) module.fixedY[i] = a * module.fixedX[i] + module.fixedY[i];
+  });
+
+  double fixedPointer = measure(nIterations, [&](float a) {
+    float* y = module.fixedY.begin();
+    const float* x = module.fixedX.begin();
+    for(size_t i = 0; i < N; ++i) y[i] = a * x[i] + y[i];
+  });
+
+  // print a result so the computation cannot be optimised away
+  std::cout << std::setw(8) << N << std::setw(16) << dynamic << std::setw(20) << fixedIndexed << std::setw(20)
+            << fixedPointer << "    (" << module.dynamicY[N - 1] << " " << module.fixedY[N - 1] << ")" << std::endl;
+}
+
+/*********************************************************************************************************************/
+
+int main() {
+  BenchmarkApplication app;
+  // creates the accessor implementations, the application is not started
+  ctk::TestFacility test(false);
+
+  std::cout << std::setw(8) << "length" << std::setw(16) << "dynamic [ns]" << std::setw(20) << "fixed [ns]"
+            << std::setw(20) << "fixed pointer [ns]" << std::endl;
+  run(app.module4);
+  run(app.module8);
+  run(app.module16);
+
+  return 0;
+}
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the resolution of the virtual hierarchy. The number of heap allocations and the run time is measured
+ *  - for splitting qualified names into path segments, comparing the previous implementation (boost::split into a
+ *    vector of strings) with the interned path segments of the StringInterner,
+ *  - for constructing an application with N variables in HierarchyModifyingGroups and for resolving its virtual
+ *    hierarchy with findTag().
+ */
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "HierarchyModifyingGroup.h"
+#include "ScalarAccessor.h"
+#include "StringInterner.h"
+#include "VirtualModule.h"
+
+#include <boost/algorithm/string.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <new>
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+static std::atomic<size_t> nAllocations{0};
+
+void* operator new(size_t size) {
+  ++nAllocations;
+  void* p = std::malloc(size == 0 ? 1 : size);
+  if(p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  std::free(p);
+}
+
+/*********************************************************************************************************************/
+
+/** Measure number of allocations and run time of the given function */
+template<typename FUNCTION>
+static void measure(const std::string& label, size_t n, FUNCTION function) {
+  size_t allocationsBefore = nAllocations;
+  auto start = std::chrono::steady_clock::now();
+  function();
+  std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+  size_t allocations = nAllocations - allocationsBefore;
+  std::cout << std::setw(40) << label << std::setw(12) << n << std::setw(16) << allocations << std::setw(16)
+            << double(allocations) / double(n) << std::setw(16) << duration.count() << std::endl;
+}
+
+/*********************************************************************************************************************/
+
+struct TestModule : public ctk::ApplicationModule {
+  TestModule(EntityOwner* owner, const std::string& name, size_t nVariables) : ctk::ApplicationModule(owner, name, "") {
+    for(size_t i = 0; i < nVariables; ++i) {
+      variables.emplace_back(this, "../shared/group" + std::to_string(i % 10) + "/var" + std::to_string(i), "", "");
+    }
+  }
+  TestModule() { throw; } // work around for gcc bug: constructor must be present but is unused
+
+  std::list<ctk::ModifyHierarchy<ctk::ScalarOutput<int32_t>>> variables;
+
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct BenchmarkApplication : public ctk::Application {
+  explicit BenchmarkApplication(size_t nVariables)
+  : Application("benchmarkHierarchyResolution"), a(this, "a", nVariables / 2), b(this, "b", nVariables / 2) {}
+  ~BenchmarkApplication() override { shutdown(); }
+
+  TestModule a;
+  TestModule b;
+};
+
+/*********************************************************************************************************************/
+
+int main() {
+  std::cout << std::setw(40) << "operation" << std::setw(12) << "n" << std::setw(16) << "allocations"
+            << std::setw(16) << "allocs/item" << std::setw(16) << "time [ms]" << std::endl;
+
+  for(size_t n : {1000, 10000, 100000}) {
+    std::vector<std::string> paths;
+    for(size_t i = 0; i < n; ++i) {
+      paths.push_back("../some/deep/hierarchy/group" + std::to_string(i % 100) + "/variable");
+    }
+
+    measure("split (boost::split, before)", n, [&] {
+      for(auto& path : paths) {
+        std::vector<std::string> splittedPath;
+        boost::split(splittedPath, path, boost::is_any_of("/"));
+      }
+    });
+
+    measure("split (interned segments, after)", n, [&] {
+      std::vector<ctk::StringInterner::Id> splittedPath;
+      for(auto& path : paths) {
+        splittedPath.clear();
+        ctk::StringInterner::splitPath(path, splittedPath);
+      }
+    });
+  }
+
+  for(size_t n : {1000, 10000, 100000}) {
+    std::unique_ptr<BenchmarkApplication> app;
+    measure("construct application", n, [&] { app = std::make_unique<BenchmarkApplication>(n); });
+    measure("findTag()", n, [&] { app->findTag(".*"); });
+  }
+
+  return 0;
+}
+
+/*********************************************************************************************************************/
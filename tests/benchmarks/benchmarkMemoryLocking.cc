@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the memory locking and huge pages, see Application::enableMemoryLocking(). Two effects are measured:
+ *  - TLB misses: time per element of random reads from a large array buffer, backed by normal pages and after advising
+ *    transparent huge pages
+ *  - page faults: number of minor page faults and time of the first pass over a freshly allocated buffer (like an
+ *    array buffer allocated before the application is started), without and with locking the current memory
+ */
+
+#include "MemoryLocking.h"
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+static long minorFaults() {
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_minflt;
+}
+
+/*********************************************************************************************************************/
+
+static double randomReadTime(const std::vector<float>& buffer, const std::vector<uint32_t>& indices) {
+  float sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for(auto index : indices) sum += buffer[index];
+  auto stop = std::chrono::steady_clock::now();
+  // prevent the loop from being optimised away
+  if(sum == -1) std::cout << sum;
+  return double(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) / double(indices.size());
+}
+
+/*********************************************************************************************************************/
+
+static void firstPass(size_t nElements, bool lock) {
+  // Application::run() locks the memory after the buffers have been allocated, which faults in their pages
+  std::unique_ptr<float[]> buffer(new float[nElements]);
+  std::string error;
+  if(lock && !ctk::MemoryLocking::lockCurrent(error)) {
+    std::cout << "  cannot lock memory: " << error << std::endl;
+    return;
+  }
+  auto faultsBefore = minorFaults();
+  auto start = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < nElements; ++i) buffer[i] = float(i);
+  auto stop = std::chrono::steady_clock::now();
+  std::cout << "  minor faults: " << minorFaults() - faultsBefore << ", time: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(stop - start).count() << " us" << std::endl;
+}
+
+/*********************************************************************************************************************/
+
+int main() {
+  constexpr size_t nElements = 64 * 1024 * 1024; // 256 MiB of floats
+  constexpr size_t nReads = 10 * 1000 * 1000;
+
+  std::vector<float> buffer(nElements, 1.F);
+  std::vector<uint32_t> indices(nReads);
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<uint32_t> distribution(0, nElements - 1);
+  for(auto& index : indices) index = distribution(generator);
+
+  std::cout << "Random reads from a 256 MiB buffer:" << std::endl;
+  std::cout << "  normal pages: " << randomReadTime(buffer, indices) << " ns per read" << std::endl;
+  auto hugePageSize = ctk::MemoryLocking::getHugePageSize();
+  if(hugePageSize == 0) {
+    std::cout << "  transparent huge pages not available" << std::endl;
+  }
+  else {
+    std::ifstream maps("/proc/self/maps");
+    auto regions = ctk::MemoryLocking::findLargeAnonymousRegions(maps, hugePageSize);
+    auto advised = ctk::MemoryLocking::adviseHugePages(regions, hugePageSize);
+    std::cout << "  huge pages (" << advised / (1024 * 1024) << " MiB advised): " << randomReadTime(buffer, indices)
+              << " ns per read" << std::endl;
+  }
+
+  std::cout << "First pass over a newly allocated 64 MiB buffer without memory locking:" << std::endl;
+  firstPass(nElements / 4, false);
+  std::cout << "First pass over a newly allocated 64 MiB buffer with memory locking:" << std::endl;
+  firstPass(nElements / 4, true);
+
+  return 0;
+}
+
+/*********************************************************************************************************************/
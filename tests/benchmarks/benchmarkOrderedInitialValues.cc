@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the ordered initial values, see Application::enableOrderedInitialValues(). The application consists of
+ * a number of layers with a number of modules each. Each module reads the outputs of all modules of the previous layer
+ * and writes a preliminary initial value in prepare(), like modules which are part of circular networks often do.
+ * Measured are the number of computations and output writes until the application has reached its steady state, and
+ * the time from starting the application until the last layer has published its final value.
+ */
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ScalarAccessor.h"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <thread>
+#include <vector>
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+static std::atomic<size_t> nComputations{0};
+static std::atomic<size_t> nFinalOutputs{0};
+
+/*********************************************************************************************************************/
+
+struct Source : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> trigger{this, "trigger", "", ""};
+  ctk::ScalarOutput<int> output{this, "output", "", ""};
+
+  void prepare() override {
+    output = -1;
+    writeAll();
+  }
+
+  void mainLoop() override {
+    output = 0;
+    writeAll();
+    while(true) trigger.read();
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct Stage : public ctk::ApplicationModule {
+  Stage(EntityOwner* owner, const std::string& name, size_t nInputs, int finalValue)
+  : ctk::ApplicationModule(owner, name, ""), _finalValue(finalValue) {
+    for(size_t i = 0; i < nInputs; ++i) inputs.emplace_back(this, "input" + std::to_string(i), "", "");
+  }
+  Stage() { throw; } // work around for gcc bug: constructor must be present but is unused
+
+  std::vector<ctk::ScalarPushInput<int>> inputs;
+  ctk::ScalarOutput<int> output{this, "output", "", ""};
+  int _finalValue;
+
+  void prepare() override {
+    output = -1;
+    writeAll();
+  }
+
+  void mainLoop() override {
+    auto group = readAnyGroup();
+    bool isFinal = false;
+    while(true) {
+      int maximum = inputs.front();
+      for(auto& input : inputs) maximum = std::max(maximum, int(input));
+      output = maximum + 1;
+      ++nComputations;
+      writeAll();
+      if(!isFinal && output == _finalValue) {
+        isFinal = true;
+        ++nFinalOutputs;
+      }
+      group.readAny();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct BenchmarkApplication : public ctk::Application {
+  BenchmarkApplication(size_t nLayers, size_t width, bool ordered) : Application("benchmarkOrderedInitialValues") {
+    for(size_t i = 0; i < width; ++i) sources.emplace_back(this, "Source" + std::to_string(i), "");
+    for(size_t layer = 1; layer <= nLayers; ++layer) {
+      for(size_t i = 0; i < width; ++i) {
+        stages.emplace_back(this, "Stage" + std::to_string(layer) + "_" + std::to_string(i), width, int(layer));
+      }
+    }
+    if(ordered) enableOrderedInitialValues();
+  }
+  ~BenchmarkApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    // each stage reads the outputs of all modules of the previous layer
+    std::vector<ctk::ScalarOutput<int>*> previousLayer;
+    for(auto& source : sources) previousLayer.push_back(&source.output);
+    std::vector<ctk::ScalarOutput<int>*> currentLayer;
+    for(auto& stage : stages) {
+      for(size_t k = 0; k < previousLayer.size(); ++k) *previousLayer[k] >> stage.inputs[k];
+      currentLayer.push_back(&stage.output);
+      if(currentLayer.size() == previousLayer.size()) {
+        previousLayer.swap(currentLayer);
+        currentLayer.clear();
+      }
+    }
+  }
+
+  std::list<Source> sources;
+  std::list<Stage> stages;
+};
+
+/*********************************************************************************************************************/
+
+int main() {
+  std::cout << std::setw(8) << "layers" << std::setw(8) << "width" << std::setw(10) << "ordered" << std::setw(16)
+            << "computations" << std::setw(22) << "steady state [ms]" << std::endl;
+
+  for(size_t nLayers : {5, 20}) {
+    for(size_t width : {1, 4}) {
+      for(bool ordered : {false, true}) {
+        nComputations = 0;
+        nFinalOutputs = 0;
+        BenchmarkApplication app(nLayers, width, ordered);
+        app.initialise();
+        auto start = std::chrono::steady_clock::now();
+        app.run();
+        while(nFinalOutputs < nLayers * width) std::this_thread::sleep_for(std::chrono::microseconds(100));
+        std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+        // let remaining recomputations settle before counting
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        std::cout << std::setw(8) << nLayers << std::setw(8) << width << std::setw(10) << (ordered ? "yes" : "no")
+                  << std::setw(16) << nComputations << std::setw(22) << duration.count() << std::endl;
+      }
+    }
+  }
+
+  return 0;
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the priority-ordered wakeup of fan out slaves (see ApplicationModule::setPriority()). A writer thread
+ * distributes a time stamp to many low priority consumers and one high priority consumer, like a fan out does. The
+ * low priority consumers do some busy work after each update, so the CPUs are contended. The wakeup latency of the
+ * high priority consumer (time between the start of the fan out cycle and the return of its read()) is measured
+ *  - when its slave is written last (order in which the slaves have been added),
+ *  - when its slave is written first (priority ordered),
+ * each with and without SCHED_FIFO for the high priority consumer (only if the permission is available).
+ */
+
+#include <ChimeraTK/ControlSystemAdapter/ProcessArray.h>
+#include <ChimeraTK/ScalarRegisterAccessor.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <thread>
+#include <vector>
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+static int64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/*********************************************************************************************************************/
+
+struct Result {
+  double median;
+  double p99;
+  double max;
+};
+
+/*********************************************************************************************************************/
+
+static Result measure(size_t nLowConsumers, bool highFirst, bool realtime, size_t nIterations) {
+  using Pair = std::pair<boost::shared_ptr<ctk::NDRegisterAccessor<int64_t>>,
+      boost::shared_ptr<ctk::NDRegisterAccessor<int64_t>>>;
+  auto create = [] {
+    return ctk::createSynchronizedProcessArray<int64_t>(
+        1, "slave", "", "", {}, 3, {ctk::AccessMode::wait_for_new_data});
+  };
+
+  // the slaves in the order they are written
+  std::list<Pair> pairs;
+  for(size_t i = 0; i < nLowConsumers; ++i) pairs.push_back(create());
+  auto highPair = create();
+  if(highFirst) {
+    pairs.push_front(highPair);
+  }
+  else {
+    pairs.push_back(highPair);
+  }
+
+  std::atomic<bool> done{false};
+
+  // low priority consumers: busy work after each update
+  std::vector<std::thread> lowConsumers;
+  for(auto& pair : pairs) {
+    if(pair == highPair) continue;
+    lowConsumers.emplace_back([&done, receiver = pair.second] {
+      ctk::ScalarRegisterAccessor<int64_t> input(receiver);
+      while(!done) {
+        input.read();
+        auto until = now() + 200000;
+        while(now() < until) {
+        }
+      }
+    });
+  }
+
+  // high priority consumer: measure the wakeup latency
+  std::vector<double> latencies;
+  latencies.reserve(nIterations);
+  std::thread highConsumer([&] {
+    if(realtime) {
+      sched_param param{};
+      param.sched_priority = 40;
+      pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    }
+    ctk::ScalarRegisterAccessor<int64_t> input(highPair.second);
+    for(size_t i = 0; i < nIterations; ++i) {
+      input.read();
+      latencies.push_back(double(now() - int64_t(input)) / 1000.);
+    }
+  });
+
+  // writer: the "fan out" thread
+  std::vector<ctk::ScalarRegisterAccessor<int64_t>> outputs;
+  for(auto& pair : pairs) outputs.emplace_back(pair.first);
+  for(size_t i = 0; i < nIterations; ++i) {
+    auto cycleStart = now();
+    for(auto& output : outputs) {
+      output = cycleStart;
+      output.writeDestructively();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  highConsumer.join();
+
+  // wake up the low priority consumers until they have noticed the end
+  done = true;
+  for(auto& output : outputs) output.writeDestructively();
+  for(auto& consumer : lowConsumers) consumer.join();
+
+  std::sort(latencies.begin(), latencies.end());
+  return {latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100], latencies.back()};
+}
+
+/*********************************************************************************************************************/
+
+static bool canUseRealtime() {
+  bool ok = false;
+  std::thread t([&] {
+    sched_param param{};
+    param.sched_priority = 40;
+    ok = (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0);
+  });
+  t.join();
+  return ok;
+}
+
+/*********************************************************************************************************************/
+
+int main() {
+  size_t nIterations = 2000;
+  size_t nCpus = std::max(1U, std::thread::hardware_concurrency());
+  bool realtime = canUseRealtime();
+  if(!realtime) std::cout << "SCHED_FIFO not permitted, measuring with the default policy only." << std::endl;
+
+  std::cout << std::setw(12) << "consumers" << std::setw(12) << "order" << std::setw(12) << "policy" << std::setw(16)
+            << "median [us]" << std::setw(16) << "p99 [us]" << std::setw(16) << "max [us]" << std::endl;
+  for(size_t nLowConsumers : {nCpus, 4 * nCpus}) {
+    for(bool useRealtime : {false, true}) {
+      if(useRealtime && !realtime) continue;
+      for(bool highFirst : {false, true}) {
+        auto result = measure(nLowConsumers, highFirst, useRealtime, nIterations);
+        std::cout << std::setw(12) << nLowConsumers << std::setw(12) << (highFirst ? "first" : "last") << std::setw(12)
+                  << (useRealtime ? "FIFO" : "default") << std::setw(16) << result.median << std::setw(16)
+                  << result.p99 << std::setw(16) << result.max << std::endl;
+      }
+    }
+  }
+
+  return 0;
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the adaptive spinning before blocking in read(), see ApplicationModule::setReadSpinTime(). A producer
+ * thread sends time stamps with a fixed period through a synchronised ProcessArray pair. The consumer reads them with
+ * plain blocking reads and through a decorator spinning before the read. For different periods, the following figures
+ * are measured:
+ *  - wakeup latency: time between the write and the return of the read (median and 99th percentile)
+ *  - CPU cost: CPU time consumed by the consumer thread per received value
+ *  - spin hits: fraction of reads in which the data arrived while spinning
+ */
+
+#include "AdaptiveSpinWait.h"
+
+#include <ChimeraTK/ControlSystemAdapter/ProcessArray.h>
+#include <ChimeraTK/NDRegisterAccessorDecorator.h>
+#include <ChimeraTK/ScalarRegisterAccessor.h>
+
+#include <time.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+/* Minimal decorator spinning before a blocking read(), so the spinning can be measured on a plain ProcessArray without
+ * the decorators of the application accessors */
+class SpinningReadDecorator : public ctk::NDRegisterAccessorDecorator<int64_t> {
+ public:
+  SpinningReadDecorator(
+      const boost::shared_ptr<ctk::NDRegisterAccessor<int64_t>>& target, std::chrono::nanoseconds maxSpinTime)
+  : ctk::NDRegisterAccessorDecorator<int64_t>(target), _spinWait(maxSpinTime), _targetQueue(target->getReadQueue()) {}
+
+  void doPreRead(ctk::TransferType type) override {
+    if(type == ctk::TransferType::read) _spinWait.wait(_targetQueue);
+    ctk::NDRegisterAccessorDecorator<int64_t>::doPreRead(type);
+  }
+
+  void doPostRead(ctk::TransferType type, bool hasNewData) override {
+    if(hasNewData) _spinWait.arrived();
+    ctk::NDRegisterAccessorDecorator<int64_t>::doPostRead(type, hasNewData);
+  }
+
+  const ctk::AdaptiveSpinWait& getSpinWait() const { return _spinWait; }
+
+ protected:
+  ctk::AdaptiveSpinWait _spinWait;
+  cppext::future_queue<void> _targetQueue;
+};
+
+/*********************************************************************************************************************/
+
+static int64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/*********************************************************************************************************************/
+
+static double threadCpuTime() {
+  timespec ts{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return double(ts.tv_sec) * 1e9 + double(ts.tv_nsec);
+}
+
+/*********************************************************************************************************************/
+
+struct Result {
+  double medianLatency;
+  double p99Latency;
+  double cpuPerValue;
+  double spinHitRate;
+};
+
+/*********************************************************************************************************************/
+
+static Result measure(std::chrono::nanoseconds period, std::chrono::nanoseconds maxSpinTime, size_t nValues) {
+  auto pair = ctk::createSynchronizedProcessArray<int64_t>(
+      1, "variable", "", "", {}, 3, {ctk::AccessMode::wait_for_new_data});
+  boost::shared_ptr<ctk::NDRegisterAccessor<int64_t>> receiverImpl = pair.second;
+  boost::shared_ptr<SpinningReadDecorator> decorator;
+  if(maxSpinTime.count() > 0) {
+    decorator = boost::make_shared<SpinningReadDecorator>(pair.second, maxSpinTime);
+    receiverImpl = decorator;
+  }
+  ctk::ScalarRegisterAccessor<int64_t> sender(pair.first), receiver(receiverImpl);
+
+  std::vector<double> latencies;
+  latencies.reserve(nValues);
+  double cpuTime = 0;
+  std::thread consumer([&] {
+    auto cpuStart = threadCpuTime();
+    for(size_t i = 0; i < nValues; ++i) {
+      receiver.read();
+      latencies.push_back(double(now() - int64_t(receiver)));
+    }
+    cpuTime = threadCpuTime() - cpuStart;
+  });
+
+  // busy wait in the producer for an accurate period
+  auto next = now();
+  for(size_t i = 0; i < nValues; ++i) {
+    next += period.count();
+    while(now() < next) {
+    }
+    sender = now();
+    sender.write();
+  }
+  consumer.join();
+
+  std::sort(latencies.begin(), latencies.end());
+  double hitRate = 0;
+  if(decorator) hitRate = double(decorator->getSpinWait().getSpinHits()) / double(nValues);
+  return {latencies[nValues / 2], latencies[nValues * 99 / 100], cpuTime / double(nValues), hitRate};
+}
+
+/*********************************************************************************************************************/
+
+int main() {
+  using namespace std::chrono_literals;
+
+  std::cout << std::setw(12) << "period [us]" << std::setw(12) << "spin [us]" << std::setw(16) << "median [ns]"
+            << std::setw(16) << "p99 [ns]" << std::setw(16) << "CPU/value [ns]" << std::setw(12) << "hit rate"
+            << std::endl;
+  for(auto period : {5us, 20us, 100us, 1000us}) {
+    size_t nValues = std::max(size_t(1000), size_t(std::chrono::nanoseconds(2s) / period));
+    for(auto maxSpinTime : {0us, 10us, 50us}) {
+      auto result = measure(period, maxSpinTime, nValues);
+      std::cout << std::setw(12) << period.count() << std::setw(12) << maxSpinTime.count() << std::setw(16)
+                << result.medianLatency << std::setw(16) << result.p99Latency << std::setw(16) << result.cpuPerValue
+                << std::setw(12) << result.spinHitRate << std::endl;
+    }
+  }
+
+  return 0;
+}
+
+/*********************************************************************************************************************/
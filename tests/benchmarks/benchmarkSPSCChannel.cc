@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the SPSCChannel used for 1:1 connections between application modules, compared to the synchronised
+ * ProcessArray pair used before. Two figures are measured for different array lengths:
+ *  - latency: round trip time of a ping-pong between two threads through two channels, divided by two
+ *  - throughput: time per value when one thread writes continuously while the other thread reads
+ */
+
+#include "SPSCChannel.h"
+
+#include <ChimeraTK/ControlSystemAdapter/ProcessArray.h>
+#include <ChimeraTK/OneDRegisterAccessor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+namespace ctk = ChimeraTK;
+
+using Pair = std::pair<boost::shared_ptr<ctk::NDRegisterAccessor<float>>,
+    boost::shared_ptr<ctk::NDRegisterAccessor<float>>>;
+using Factory = std::function<Pair(size_t)>;
+
+/*********************************************************************************************************************/
+
+static double measureLatency(const Factory& factory, size_t nElements, size_t nIterations) {
+  auto there = factory(nElements);
+  auto back = factory(nElements);
+  ctk::OneDRegisterAccessor<float> ping(there.first), pingReceiver(there.second);
+  ctk::OneDRegisterAccessor<float> pong(back.first), pongReceiver(back.second);
+
+  std::thread echo([&] {
+    for(size_t i = 0; i < nIterations; ++i) {
+      pingReceiver.read();
+      pong[0] = pingReceiver[0];
+      pong.writeDestructively();
+    }
+  });
+
+  auto start = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < nIterations; ++i) {
+    ping[0] = float(i);
+    ping.write();
+    pongReceiver.read();
+  }
+  std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+  echo.join();
+  return duration.count() / double(nIterations) / 2.;
+}
+
+/*********************************************************************************************************************/
+
+static double measureThroughput(const Factory& factory, size_t nElements, size_t nIterations) {
+  auto pair = factory(nElements);
+  ctk::OneDRegisterAccessor<float> sender(pair.first), receiver(pair.second);
+
+  // the last value is written repeatedly until it has been received, since intermediate values may be lost
+  std::atomic<bool> done{false};
+  auto start = std::chrono::steady_clock::now();
+  std::thread producer([&] {
+    for(size_t i = 0; i < nIterations; ++i) {
+      sender[0] = float(i);
+      sender.write();
+    }
+    sender[0] = -1;
+    while(!done) {
+      sender.write();
+      std::this_thread::sleep_for(std::chrono::microseconds(10));
+    }
+  });
+
+  do {
+    receiver.read();
+  } while(receiver[0] >= 0);
+  done = true;
+  std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+  producer.join();
+  return duration.count() / double(nIterations);
+}
+
+/*********************************************************************************************************************/
+
+int main() {
+  Factory processArray = [](size_t nElements) -> Pair {
+    return ctk::createSynchronizedProcessArray<float>(
+        nElements, "processArray", "", "", {}, 3, {ctk::AccessMode::wait_for_new_data});
+  };
+  Factory spscChannel = [](size_t nElements) -> Pair {
+    return ctk::createSPSCChannel<float>(nElements, "spscChannel", "", "", 3, {ctk::AccessMode::wait_for_new_data});
+  };
+
+  std::cout << std::setw(8) << "length" << std::setw(24) << "ProcessArray lat. [ns]" << std::setw(24)
+            << "SPSCChannel lat. [ns]" << std::setw(24) << "ProcessArray thr. [ns]" << std::setw(24)
+            << "SPSCChannel thr. [ns]" << std::endl;
+  for(size_t nElements : {1, 16, 1024, 65536}) {
+    size_t nIterations = std::max(size_t(1000), size_t(10000000) / (nElements + 100));
+    std::cout << std::setw(8) << nElements << std::setw(24) << measureLatency(processArray, nElements, nIterations)
+              << std::setw(24) << measureLatency(spscChannel, nElements, nIterations) << std::setw(24)
+              << measureThroughput(processArray, nElements, nIterations) << std::setw(24)
+              << measureThroughput(spscChannel, nElements, nIterations) << std::endl;
+  }
+
+  return 0;
+}
+
+/*********************************************************************************************************************/
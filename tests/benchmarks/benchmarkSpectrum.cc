@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the FFTPlan used by the Spectrum module. Compares the transform with a cached plan against creating
+ * a new plan for each call, and (for small lengths) against the naive O(n^2) DFT.
+ */
+
+#include "Spectrum.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+template<typename FUNCTOR>
+static double measure(size_t nIterations, FUNCTOR functor) {
+  auto start = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < nIterations; ++i) functor();
+  std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+  return duration.count() / double(nIterations);
+}
+
+/*********************************************************************************************************************/
+
+int main() {
+  std::mt19937 generator(42);
+  std::normal_distribution<double> distribution;
+
+  std::cout << std::setw(8) << "length" << std::setw(16) << "cached [us]" << std::setw(16) << "re-plan [us]"
+            << std::setw(16) << "naive DFT [us]" << std::endl;
+
+  for(size_t n : {64, 100, 1000, 1024, 4096, 10000, 65536}) {
+    std::vector<ctk::FFTPlan::Complex> input(n), data(n), workspace;
+    for(auto& v : input) v = {distribution(generator), 0.};
+    size_t nIterations = std::max(size_t(10), size_t(1000000) / n);
+
+    auto plan = ctk::FFTPlan::get(n);
+    double cached = measure(nIterations, [&] {
+      data = input;
+      plan->transform(data, workspace);
+    });
+
+    double replan = measure(nIterations, [&] {
+      data = input;
+      ctk::FFTPlan(n).transform(data, workspace);
+    });
+
+    std::cout << std::setw(8) << n << std::setw(16) << cached << std::setw(16) << replan;
+
+    if(n <= 4096) {
+      double naive = measure(std::max(size_t(1), nIterations / 100), [&] {
+        for(size_t k = 0; k < n; ++k) {
+          ctk::FFTPlan::Complex sum = 0;
+          for(size_t j = 0; j < n; ++j) sum += input[j] * std::polar(1., -2. * M_PI * double((j * k) % n) / double(n));
+          data[k] = sum;
+        }
+      });
+      std::cout << std::setw(16) << naive;
+    }
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the memory footprint of the thread stacks, see Application::setThreadStackSize(). A number of idle
+ * threads is started with the default stack size and with configured stack sizes, like the module threads of a large
+ * application. The increase of the virtual memory size and of the resident memory of the process is measured, and
+ * the stack high-water mark of the threads is reported.
+ */
+
+#include "ThreadStack.h"
+
+#include <boost/thread.hpp>
+
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+/** Read a value in kiB from /proc/self/status */
+static size_t readStatus(const std::string& key) {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while(std::getline(status, line)) {
+    if(line.compare(0, key.size() + 1, key + ":") == 0) return std::stoul(line.substr(key.size() + 1));
+  }
+  return 0;
+}
+
+/*********************************************************************************************************************/
+
+int main() {
+  constexpr size_t nThreads = 1000;
+
+  std::cout << std::setw(16) << "stack [kiB]" << std::setw(20) << "VmSize/thread [kiB]" << std::setw(20)
+            << "VmRSS/thread [kiB]" << std::setw(22) << "high-water mark [kiB]" << std::endl;
+
+  for(size_t stackSize : {size_t(0), size_t(1024 * 1024), size_t(256 * 1024), size_t(64 * 1024)}) {
+    auto vmSizeBefore = readStatus("VmSize");
+    auto vmRssBefore = readStatus("VmRSS");
+
+    boost::thread::attributes attributes;
+    ctk::ThreadStack::setAttributes(attributes, stackSize, 64 * 1024);
+    std::atomic<size_t> nStarted{0};
+    std::atomic<size_t> maxHighWaterMark{0};
+    std::atomic<bool> terminate{false};
+    std::vector<boost::thread> threads;
+    for(size_t i = 0; i < nThreads; ++i) {
+      threads.emplace_back(attributes, [&] {
+        ctk::ThreadStack::Bounds bounds;
+        if(ctk::ThreadStack::getCurrentBounds(bounds)) {
+          ctk::ThreadStack::paintUnused(bounds);
+          auto highWaterMark = ctk::ThreadStack::getHighWaterMark(bounds);
+          auto previous = maxHighWaterMark.load();
+          while(previous < highWaterMark && !maxHighWaterMark.compare_exchange_weak(previous, highWaterMark)) {
+          }
+        }
+        ++nStarted;
+        while(!terminate) boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+      });
+    }
+    while(nStarted < nThreads) boost::this_thread::sleep_for(boost::chrono::milliseconds(1));
+
+    auto vmSize = double(readStatus("VmSize") - vmSizeBefore) / double(nThreads);
+    auto vmRss = double(readStatus("VmRSS") - vmRssBefore) / double(nThreads);
+    terminate = true;
+    for(auto& thread : threads) thread.join();
+
+    std::cout << std::setw(16) << (stackSize == 0 ? std::string("default") : std::to_string(stackSize / 1024))
+              << std::setw(20) << vmSize << std::setw(20) << vmRss << std::setw(22) << maxHighWaterMark / 1024
+              << std::endl;
+  }
+
+  return 0;
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,8 @@
+#!/bin/bash
+
+echo starting slow device init
+
+# never finishes in time, the init handler has to kill it (including the sleep process)
+sleep 100
+
+echo slow device init finished
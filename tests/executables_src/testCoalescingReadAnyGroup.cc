@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testCoalescingReadAnyGroup
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "CoalescingReadAnyGroup.h"
+#include "ScalarAccessor.h"
+#include "SPSCChannel.h"
+#include "TestFacility.h"
+
+#include <ChimeraTK/ScalarRegisterAccessor.h>
+
+#include <boost/test/included/unit_test.hpp>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+/* Writes all outputs with the same version number for each trigger */
+struct Source : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> trigger{this, "trigger", "", ""};
+  ctk::ScalarOutput<int> a{this, "a", "", ""};
+  ctk::ScalarOutput<int> b{this, "b", "", ""};
+  ctk::ScalarOutput<int> c{this, "c", "", ""};
+
+  void mainLoop() override {
+    while(true) {
+      a = trigger;
+      b = trigger + 1;
+      c = trigger + 2;
+      writeAll();
+      trigger.read();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+/* Counts the number of computations */
+struct Sink : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> a{this, "a", "", ""};
+  ctk::ScalarPushInput<int> b{this, "b", "", ""};
+  ctk::ScalarPushInput<int> c{this, "c", "", ""};
+  ctk::ScalarOutput<int> sum{this, "sum", "", ""};
+  ctk::ScalarOutput<int> nComputations{this, "nComputations", "", ""};
+
+  void mainLoop() override {
+    auto group = coalescingReadAnyGroup();
+    while(true) {
+      sum = a + b + c;
+      nComputations = nComputations + 1;
+      writeAll();
+      group.readAny();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    source.a >> sink.a;
+    source.b >> sink.b;
+    source.c >> sink.c;
+    Application::defineConnections();
+  }
+
+  Source source{this, "Source", ""};
+  Sink sink{this, "Sink", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testCoalescing) {
+  std::cout << "testCoalescing" << std::endl;
+  auto pairA = ctk::createSPSCChannel<int>(1, "a", "", "", 3, {ctk::AccessMode::wait_for_new_data});
+  auto pairB = ctk::createSPSCChannel<int>(1, "b", "", "", 3, {ctk::AccessMode::wait_for_new_data});
+  auto pairC = ctk::createSPSCChannel<int>(1, "c", "", "", 3, {ctk::AccessMode::wait_for_new_data});
+  ctk::ScalarRegisterAccessor<int> senderA(pairA.first), senderB(pairB.first), senderC(pairC.first);
+  ctk::ScalarRegisterAccessor<int> a(pairA.second), b(pairB.second), c(pairC.second);
+  ctk::CoalescingReadAnyGroup group{a, b, c};
+
+  // all updates with the same version are returned at once
+  ctk::VersionNumber v1;
+  senderA = 1;
+  senderA.write(v1);
+  senderC = 3;
+  senderC.write(v1);
+  auto updates = group.readAny();
+  BOOST_REQUIRE_EQUAL(updates.size(), 2);
+  BOOST_CHECK(updates[0] == a.getId());
+  BOOST_CHECK(updates[1] == c.getId());
+  BOOST_CHECK(group.getVersionNumber() == v1);
+  BOOST_CHECK_EQUAL(int(a), 1);
+  BOOST_CHECK_EQUAL(int(c), 3);
+
+  // an update with a different version ends the collection and is returned by the next call without blocking
+  ctk::VersionNumber v2, v3;
+  senderB = 2;
+  senderB.write(v2);
+  senderA = 4;
+  senderA.write(v3);
+  senderC = 5;
+  senderC.write(v3);
+  updates = group.readAny();
+  BOOST_REQUIRE_EQUAL(updates.size(), 1);
+  BOOST_CHECK(updates[0] == b.getId());
+  BOOST_CHECK(group.getVersionNumber() == v2);
+  updates = group.readAny();
+  BOOST_REQUIRE_EQUAL(updates.size(), 2);
+  BOOST_CHECK(updates[0] == a.getId());
+  BOOST_CHECK(updates[1] == c.getId());
+  BOOST_CHECK(group.getVersionNumber() == v3);
+  BOOST_CHECK_EQUAL(int(a), 4);
+  BOOST_CHECK_EQUAL(int(c), 5);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testModule) {
+  std::cout << "testModule" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.runApplication();
+  auto nComputations = test.readScalar<int>("/Sink/nComputations");
+
+  // each trigger updates all inputs of the sink with the same version, which results in a single computation
+  for(int i = 1; i <= 3; ++i) {
+    test.writeScalar<int>("/Source/trigger", 10 * i);
+    test.stepApplication();
+    BOOST_CHECK_EQUAL(test.readScalar<int>("/Sink/sum"), 30 * i + 3);
+    BOOST_CHECK_EQUAL(test.readScalar<int>("/Sink/nComputations"), nComputations + i);
+  }
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testConnectionGraphExport
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <sstream>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct ModuleA : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+  ctk::ScalarOutput<int32_t> x{this, "x", "", ""};
+  void mainLoop() override {}
+};
+
+struct ModuleB : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+  ctk::ScalarPushInput<int32_t> x{this, "x", "", ""};
+  ctk::ScalarOutput<int32_t> y{this, "y", "", ""};
+  void mainLoop() override {}
+};
+
+struct ModuleC : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+  ctk::ScalarPushInput<int32_t> y{this, "y", "", "", {"myTag"}};
+  ctk::ScalarOutput<int32_t> z{this, "z", "", ""};
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    a.x >> b.x;
+    b.y >> c.y;
+  }
+
+  ModuleA a{this, "A", ""};
+  ModuleA ab{this, "AB", ""}; // name starts with the name of module A
+  ModuleB b{this, "B", ""};
+  ModuleC c{this, "C", ""};
+};
+
+/*********************************************************************************************************************/
+
+static std::string exportGraph(TestApplication& app, const ctk::ConnectionGraphFilter& filter) {
+  std::stringstream stream;
+  app.dumpConnectionGraph(stream, filter);
+  auto graph = stream.str();
+  BOOST_CHECK(graph.rfind("digraph application {\n", 0) == 0);
+  BOOST_REQUIRE(graph.size() > 2);
+  BOOST_CHECK(graph.substr(graph.size() - 2) == "}\n");
+  return graph;
+}
+
+/*********************************************************************************************************************/
+
+static bool contains(const std::string& graph, const std::string& variable) {
+  return graph.find("label=\"" + variable + "\\n") != std::string::npos;
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testNoFilter) {
+  std::cout << "testNoFilter" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+
+  auto graph = exportGraph(app, {});
+  BOOST_CHECK(contains(graph, "/testSuite/A/x"));
+  BOOST_CHECK(contains(graph, "/testSuite/AB/x"));
+  BOOST_CHECK(contains(graph, "/testSuite/B/x"));
+  BOOST_CHECK(contains(graph, "/testSuite/C/y"));
+  BOOST_CHECK(contains(graph, "/testSuite/C/z"));
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testModuleFilter) {
+  std::cout << "testModuleFilter" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+
+  ctk::ConnectionGraphFilter filter;
+  filter.modules = {"/testSuite/A"};
+
+  auto graph = exportGraph(app, filter);
+  BOOST_CHECK(contains(graph, "/testSuite/A/x"));
+  BOOST_CHECK(contains(graph, "/testSuite/B/x"));
+  BOOST_CHECK(!contains(graph, "/testSuite/AB/x"));
+  BOOST_CHECK(!contains(graph, "/testSuite/C/y"));
+
+  // with depth 1, the other connections of module B are included, but not the ones of module C
+  filter.depth = 1;
+  graph = exportGraph(app, filter);
+  BOOST_CHECK(contains(graph, "/testSuite/A/x"));
+  BOOST_CHECK(contains(graph, "/testSuite/C/y"));
+  BOOST_CHECK(!contains(graph, "/testSuite/AB/x"));
+  BOOST_CHECK(!contains(graph, "/testSuite/C/z"));
+
+  filter.depth = 2;
+  graph = exportGraph(app, filter);
+  BOOST_CHECK(contains(graph, "/testSuite/C/z"));
+  BOOST_CHECK(!contains(graph, "/testSuite/AB/x"));
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testTagFilter) {
+  std::cout << "testTagFilter" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+
+  ctk::ConnectionGraphFilter filter;
+  filter.tags = {"myTag"};
+
+  auto graph = exportGraph(app, filter);
+  BOOST_CHECK(contains(graph, "/testSuite/B/y"));
+  BOOST_CHECK(contains(graph, "/testSuite/C/y"));
+  BOOST_CHECK(!contains(graph, "/testSuite/A/x"));
+  BOOST_CHECK(!contains(graph, "/testSuite/C/z"));
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,321 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testConnectionModelCache
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "DeviceModule.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+
+#include <ChimeraTK/BackendFactory.h>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+static const std::string cacheFile = "testConnectionModelCache." + std::to_string(getpid()) + ".bin";
+
+/*********************************************************************************************************************/
+
+struct TestModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int32_t> input{this, "input", "", ""};
+  ctk::ScalarOutput<int32_t> output{this, "output", "", ""};
+
+  void mainLoop() override {
+    while(true) {
+      output = 2 * input;
+      output.write();
+      input.read();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct ExtendedModule : public TestModule {
+  using TestModule::TestModule;
+  ctk::ScalarOutput<int32_t> extra{this, "extra", "", ""};
+};
+
+/*********************************************************************************************************************/
+
+template<typename MODULE>
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") { enableConnectionModelCache(cacheFile); }
+  ~TestApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    ++nDefineConnectionsCalls;
+    Application::defineConnections();
+  }
+
+  static size_t nDefineConnectionsCalls;
+
+  MODULE module{this, "module", ""};
+};
+
+template<typename MODULE>
+size_t TestApplication<MODULE>::nDefineConnectionsCalls{0};
+
+/*********************************************************************************************************************/
+
+template<typename MODULE>
+static void checkApplication() {
+  TestApplication<MODULE> app;
+  ctk::TestFacility test;
+  test.runApplication();
+
+  test.writeScalar<int32_t>("/module/input", 21);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<int32_t>("/module/output"), 42);
+
+  BOOST_CHECK_THROW(app.enableConnectionModelCache(cacheFile), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testCache) {
+  std::cout << "testCache" << std::endl;
+  std::remove(cacheFile.c_str());
+
+  // first start: connections are resolved and the cache file is written
+  checkApplication<TestModule>();
+  BOOST_CHECK_EQUAL(TestApplication<TestModule>::nDefineConnectionsCalls, 1);
+  BOOST_CHECK(::access(cacheFile.c_str(), F_OK) == 0);
+
+  // second start: the connection model is restored, defineConnections() is not called
+  checkApplication<TestModule>();
+  BOOST_CHECK_EQUAL(TestApplication<TestModule>::nDefineConnectionsCalls, 1);
+
+  // a different module tree does not match the cache, so it is resolved and written again
+  checkApplication<ExtendedModule>();
+  BOOST_CHECK_EQUAL(TestApplication<ExtendedModule>::nDefineConnectionsCalls, 1);
+  checkApplication<ExtendedModule>();
+  BOOST_CHECK_EQUAL(TestApplication<ExtendedModule>::nDefineConnectionsCalls, 1);
+
+  // a corrupt file is ignored
+  {
+    std::ofstream file(cacheFile, std::ios::binary | std::ios::trunc);
+    file << "garbage";
+  }
+  checkApplication<TestModule>();
+  BOOST_CHECK_EQUAL(TestApplication<TestModule>::nDefineConnectionsCalls, 2);
+
+  std::remove(cacheFile.c_str());
+}
+
+/*********************************************************************************************************************/
+
+struct ConstantModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<double> constant{this, "constant", "", ""};
+  ctk::ScalarPushInput<int32_t> input{this, "input", "", ""};
+  ctk::ScalarOutput<double> output{this, "output", "", ""};
+
+  void mainLoop() override {
+    while(true) {
+      output = double(constant);
+      output.write();
+      input.read();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct ConstantApplication : public ctk::Application {
+  ConstantApplication() : Application("testSuite") { enableConnectionModelCache(cacheFile); }
+  ~ConstantApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    ++nDefineConnectionsCalls;
+    ctk::ControlSystemModule cs;
+    ctk::VariableNetworkNode::makeConstant<double>(true, 1. / 3.) >> module.constant;
+    cs("input") >> module.input;
+    module.output >> cs("output");
+  }
+
+  static size_t nDefineConnectionsCalls;
+
+  ConstantModule module{this, "module", ""};
+};
+
+size_t ConstantApplication::nDefineConnectionsCalls{0};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testConstantPrecision) {
+  std::cout << "testConstantPrecision" << std::endl;
+  std::remove(cacheFile.c_str());
+
+  // the value of a constant is restored without loss of precision
+  for(size_t i = 0; i < 2; ++i) {
+    ConstantApplication app;
+    ctk::TestFacility test;
+    test.runApplication();
+    BOOST_CHECK_EQUAL(test.readScalar<double>("/output"), 1. / 3.);
+  }
+  BOOST_CHECK_EQUAL(ConstantApplication::nDefineConnectionsCalls, 1);
+
+  std::remove(cacheFile.c_str());
+}
+
+/*********************************************************************************************************************/
+
+struct AddModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int32_t> input{this, "input", "", ""};
+  ctk::ScalarOutput<int32_t> output{this, "output", "", ""};
+
+  void mainLoop() override {
+    while(true) {
+      output = input + 1;
+      output.write();
+      input.read();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+/* Same module tree, but the order of the two modules in the chain depends on a run-time parameter */
+struct RewiredApplication : public ctk::Application {
+  RewiredApplication(bool swapped, const std::string& modelVersion) : Application("testSuite"), _swapped(swapped) {
+    enableConnectionModelCache(cacheFile, modelVersion);
+  }
+  ~RewiredApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    ++nDefineConnectionsCalls;
+    ctk::ControlSystemModule cs;
+    if(!_swapped) {
+      cs("input") >> doubler.input;
+      doubler.output >> adder.input;
+      adder.output >> cs("output");
+    }
+    else {
+      cs("input") >> adder.input;
+      adder.output >> doubler.input;
+      doubler.output >> cs("output");
+    }
+  }
+
+  static size_t nDefineConnectionsCalls;
+
+  bool _swapped;
+  TestModule doubler{this, "doubler", ""};
+  AddModule adder{this, "adder", ""};
+};
+
+size_t RewiredApplication::nDefineConnectionsCalls{0};
+
+/*********************************************************************************************************************/
+
+/* Same module tree and connections as RewiredApplication, but a different application class */
+struct OtherApplication : public RewiredApplication {
+  OtherApplication() : RewiredApplication(true, "2") {}
+};
+
+/*********************************************************************************************************************/
+
+/* Run the application and return the output for the input 1. The application must have been created before. */
+static int32_t runRewired() {
+  ctk::TestFacility test;
+  test.runApplication();
+  test.writeScalar<int32_t>("/input", 1);
+  test.stepApplication();
+  return test.readScalar<int32_t>("/output");
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testChangedConnections) {
+  std::cout << "testChangedConnections" << std::endl;
+  std::remove(cacheFile.c_str());
+
+  {
+    RewiredApplication app(false, "1");
+    BOOST_CHECK_EQUAL(runRewired(), 3);
+  }
+  {
+    RewiredApplication app(false, "1");
+    BOOST_CHECK_EQUAL(runRewired(), 3);
+  }
+  BOOST_CHECK_EQUAL(RewiredApplication::nDefineConnectionsCalls, 1);
+
+  // only the connections have changed: the model version must reject the cache
+  {
+    RewiredApplication app(true, "2");
+    BOOST_CHECK_EQUAL(runRewired(), 4);
+  }
+  BOOST_CHECK_EQUAL(RewiredApplication::nDefineConnectionsCalls, 2);
+
+  // a different application class does not match the cache either
+  {
+    OtherApplication app;
+    BOOST_CHECK_EQUAL(runRewired(), 4);
+  }
+  BOOST_CHECK_EQUAL(RewiredApplication::nDefineConnectionsCalls, 3);
+
+  std::remove(cacheFile.c_str());
+}
+
+/*********************************************************************************************************************/
+
+/* Device register read with a trigger, with statistics of the TriggerFanOut. The policy is set in defineConnections(),
+ * so the cache must restore it together with the statistics. */
+struct TriggerApplication : public ctk::Application {
+  TriggerApplication() : Application("testSuite") { enableConnectionModelCache(cacheFile); }
+  ~TriggerApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    ++nDefineConnectionsCalls;
+    ctk::ControlSystemModule cs;
+    dev("/MyModule/readBack", typeid(int32_t), 1)[cs("trigger", typeid(int32_t), 1)] >> cs("readBack");
+    setTriggerOverrunPolicy(cs("trigger"), ctk::TriggerOverrunPolicy::skipStale, "/Statistics");
+  }
+
+  static size_t nDefineConnectionsCalls;
+
+  ctk::DeviceModule dev{this, "Dummy0"};
+};
+
+size_t TriggerApplication::nDefineConnectionsCalls{0};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testTriggerStatistics) {
+  std::cout << "testTriggerStatistics" << std::endl;
+  std::remove(cacheFile.c_str());
+  ChimeraTK::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  for(size_t i = 0; i < 2; ++i) {
+    TriggerApplication app;
+    ctk::TestFacility test;
+    test.runApplication();
+
+    test.writeScalar<int32_t>("/trigger", 1);
+    test.stepApplication();
+    BOOST_CHECK_EQUAL(test.readScalar<uint64_t>("/Statistics/Dummy0/nOverruns"), 0);
+    BOOST_CHECK_EQUAL(test.readScalar<uint64_t>("/Statistics/Dummy0/nSkippedTriggers"), 0);
+    BOOST_CHECK_GE(test.readScalar<double>("/Statistics/Dummy0/cycleDuration"), 0.);
+  }
+  BOOST_CHECK_EQUAL(TriggerApplication::nDefineConnectionsCalls, 1);
+
+  std::remove(cacheFile.c_str());
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testConstantFolding
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct Source : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarOutput<int> value{this, "value", "", ""};
+
+  void prepare() override { writeAll(); }
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct Consumer : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> input{this, "input", "", ""};
+  ctk::ScalarPushInput<int> constantPush{this, "constantPush", "", ""};
+  ctk::ScalarPushInput<int> unconnectedPush{this, "unconnectedPush", "", ""};
+  ctk::ScalarPollInput<int> unconnectedPoll{this, "unconnectedPoll", "", ""};
+
+  std::atomic<int> sum{-1};
+
+  void mainLoop() override {
+    // readAll() and readAny() only wait for the connected input
+    auto group = readAnyGroup();
+    while(true) {
+      sum = input + constantPush + unconnectedPush + unconnectedPoll;
+      readAll();
+      sum = input + constantPush + unconnectedPush + unconnectedPoll;
+      group.readAny();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+/* Module with a single push-type input, which is unconnected. It must not be folded, so read() still blocks. */
+struct Lonely : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> unconnectedPush{this, "unconnectedPush", "", ""};
+
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    source.value >> consumer.input;
+    ctk::VariableNetworkNode::makeConstant<int>(true, 42) >> consumer.constantPush;
+  }
+
+  Source source{this, "Source", ""};
+  Consumer consumer{this, "Consumer", ""};
+  Lonely lonely{this, "Lonely", ""};
+};
+
+/*********************************************************************************************************************/
+
+static void waitForSum(TestApplication& app, int expected) {
+  for(size_t i = 0; i < 1000 && app.consumer.sum != expected; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  BOOST_CHECK_EQUAL(int(app.consumer.sum), expected);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testFolding) {
+  std::cout << "testFolding" << std::endl;
+  TestApplication app;
+  app.initialise();
+
+  // the constant inputs of the consumer are folded and have their value already
+  BOOST_CHECK_EQUAL(app.getNumberOfFoldedConstants(), 3);
+  BOOST_CHECK(!ctk::VariableNetworkNode(app.consumer.input).isFoldedConstant());
+  BOOST_CHECK(ctk::VariableNetworkNode(app.consumer.constantPush).isFoldedConstant());
+  BOOST_CHECK(ctk::VariableNetworkNode(app.consumer.unconnectedPush).isFoldedConstant());
+  BOOST_CHECK(ctk::VariableNetworkNode(app.consumer.unconnectedPoll).isFoldedConstant());
+  BOOST_CHECK(!ctk::VariableNetworkNode(app.lonely.unconnectedPush).isFoldedConstant());
+  BOOST_CHECK_EQUAL(int(app.consumer.constantPush), 42);
+
+  app.run();
+  waitForSum(app, 42);
+
+  app.source.value = 1;
+  app.source.value.write();
+  waitForSum(app, 43);
+  app.source.value = 2;
+  app.source.value.write();
+  waitForSum(app, 44);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testNoFoldingInTestableMode) {
+  std::cout << "testNoFoldingInTestableMode" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.runApplication();
+
+  BOOST_CHECK_EQUAL(app.getNumberOfFoldedConstants(), 0);
+  BOOST_CHECK(!ctk::VariableNetworkNode(app.consumer.constantPush).isFoldedConstant());
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testCyclicExecutive
+
+#include "Application.h"
+#include "CyclicExecutive.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct Doubler : public ctk::CyclicModule {
+  using ctk::CyclicModule::CyclicModule;
+
+  ctk::ScalarPushInput<int> input{this, "input", "", ""};
+  ctk::ScalarOutput<int> output{this, "output", "", ""};
+
+  void step() override { output = 2 * input; }
+};
+
+/*********************************************************************************************************************/
+
+struct Incrementer : public ctk::CyclicModule {
+  using ctk::CyclicModule::CyclicModule;
+
+  ctk::ScalarPushInput<int> input{this, "input", "", ""};
+  ctk::ScalarOutput<int> output{this, "output", "", ""};
+
+  void step() override { output = input + 1; }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {
+    // avoid real-time scheduling in the test
+    executive.setPriority(ctk::ModulePriority::normal);
+    executive.addModule(a);
+    executive.addModule(b);
+  }
+  ~TestApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    a.output >> b.input;
+    Application::defineConnections();
+  }
+
+  ctk::CyclicExecutive executive{this, "executive", ""};
+  Doubler a{this, "A", ""};
+  Incrementer b{this, "B", ""};
+  Doubler standalone{this, "Standalone", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testChain) {
+  std::cout << "testChain" << std::endl;
+  TestApplication app;
+  BOOST_CHECK(app.a.getExecutive() == &app.executive);
+  BOOST_CHECK(app.standalone.getExecutive() == nullptr);
+  BOOST_CHECK_THROW(app.executive.addModule(app.a), ctk::logic_error);
+
+  ctk::TestFacility test;
+  test.setScalarDefault<int>("/A/input", 2);
+  test.runApplication();
+
+  // the chain has been executed once with the initial values
+  BOOST_CHECK_EQUAL(test.readScalar<int>("/A/output"), 4);
+  BOOST_CHECK_EQUAL(test.readScalar<int>("/B/output"), 5);
+
+  // each trigger executes the entire chain once, in order
+  test.writeScalar<int>("/A/input", 3);
+  test.writeScalar<uint64_t>("/executive/trigger", 1);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<int>("/A/output"), 6);
+  BOOST_CHECK_EQUAL(test.readScalar<int>("/B/output"), 7);
+
+  // inputs without new data keep their value
+  test.writeScalar<uint64_t>("/executive/trigger", 2);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<int>("/B/output"), 7);
+
+  // statistics are published per cycle
+  BOOST_CHECK_GE(test.readScalar<double>("/executive/cycleTime"), 0.);
+  BOOST_CHECK_GE(test.readScalar<double>("/executive/worstCycleTime"), test.readScalar<double>("/executive/cycleTime"));
+  BOOST_CHECK_GE(test.readScalar<double>("/executive/A/worstStepTime"), test.readScalar<double>("/executive/A/stepTime"));
+  BOOST_CHECK_GE(test.readScalar<double>("/executive/B/stepTime"), 0.);
+  BOOST_CHECK_EQUAL(test.readScalar<uint64_t>("/executive/nOverruns"), 0);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testStandalone) {
+  std::cout << "testStandalone" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.runApplication();
+
+  // a CyclicModule which is not part of a chain executes step() on each update of its inputs in its own thread
+  BOOST_CHECK_EQUAL(test.readScalar<int>("/Standalone/output"), 0);
+  test.writeScalar<int>("/Standalone/input", 21);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<int>("/Standalone/output"), 42);
+}
+
+/*********************************************************************************************************************/
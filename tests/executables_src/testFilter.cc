@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testFilter
+
+#include "Application.h"
+#include "Filter.h"
+#include "TestFacility.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+
+  ctk::FIRFilter<double> fir{this, "FIR", "", 4, 3};
+  ctk::BiquadFilter<double> biquad{this, "Biquad", "", 4, 2};
+  ctk::FIRFilter<int32_t> intFir{this, "IntFIR", "", 1, 2};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testFIR) {
+  std::cout << "testFIR" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.setArrayDefault<double>("/FIR/coefficients", {1., 2., 4.});
+  test.runApplication();
+
+  test.writeArray<double>("/FIR/input", {1., 0., 0., 0.});
+  test.stepApplication();
+  BOOST_CHECK((test.readArray<double>("/FIR/output") == std::vector<double>{1., 2., 4., 0.}));
+
+  // the state is carried over to the next update
+  test.writeArray<double>("/FIR/input", {0., 0., 0., 1.});
+  test.stepApplication();
+  BOOST_CHECK((test.readArray<double>("/FIR/output") == std::vector<double>{0., 0., 0., 1.}));
+
+  test.writeArray<double>("/FIR/input", {0., 0., 0., 0.});
+  test.stepApplication();
+  BOOST_CHECK((test.readArray<double>("/FIR/output") == std::vector<double>{2., 4., 0., 0.}));
+
+  // coefficients can be changed at runtime
+  test.writeArray<double>("/FIR/coefficients", {0., 1., 0.});
+  test.writeArray<double>("/FIR/input", {1., 2., 3., 4.});
+  test.stepApplication();
+  BOOST_CHECK((test.readArray<double>("/FIR/output") == std::vector<double>{0., 1., 2., 3.}));
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testScalarIntegerFIR) {
+  std::cout << "testScalarIntegerFIR" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.setArrayDefault<double>("/IntFIR/coefficients", {0.5, 0.5});
+  test.runApplication();
+
+  test.writeScalar<int32_t>("/IntFIR/input", 10);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<int32_t>("/IntFIR/output"), 5);
+
+  test.writeScalar<int32_t>("/IntFIR/input", 13);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<int32_t>("/IntFIR/output"), 12); // 11.5 is rounded away from zero
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testBiquad) {
+  std::cout << "testBiquad" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  // first section: one-pole low pass y[n] = x[n] + 0.5 y[n-1], second section: pure delay by one sample
+  test.setArrayDefault<double>("/Biquad/coefficients", {1., 0., 0., -0.5, 0., 0., 1., 0., 0., 0.});
+  test.runApplication();
+
+  test.writeArray<double>("/Biquad/input", {1., 0., 0., 0.});
+  test.stepApplication();
+  BOOST_CHECK((test.readArray<double>("/Biquad/output") == std::vector<double>{0., 1., 0.5, 0.25}));
+
+  // the state of both sections is carried over to the next update
+  test.writeArray<double>("/Biquad/input", {0., 0., 0., 0.});
+  test.stepApplication();
+  BOOST_CHECK((test.readArray<double>("/Biquad/output") == std::vector<double>{0.125, 0.0625, 0.03125, 0.015625}));
+
+  // changing the coefficients resets the state
+  test.writeArray<double>("/Biquad/coefficients", {1., 0., 0., 0., 0., 1., 0., 0., 0., 0.});
+  test.writeArray<double>("/Biquad/input", {0., 0., 0., 2.});
+  test.stepApplication();
+  BOOST_CHECK((test.readArray<double>("/Biquad/output") == std::vector<double>{0., 0., 0., 2.}));
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testIllegalParameters) {
+  std::cout << "testIllegalParameters" << std::endl;
+  TestApplication app;
+  BOOST_CHECK_THROW(ctk::FIRFilter<double>(&app, "noTaps", "", 4, 0), ctk::logic_error);
+  BOOST_CHECK_THROW(ctk::BiquadFilter<double>(&app, "noSections", "", 4, 0), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testFixedArrayAccessor
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "FixedArrayAccessor.h"
+#include "TestFacility.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct TestModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::FixedArrayPushInput<int32_t, 4> input{this, "input", "", "Input vector"};
+  ctk::FixedArrayPollInput<int32_t, 4> offset{this, "offset", "", "Offset added to the input"};
+  ctk::FixedArrayOutput<int32_t, 4> output{this, "output", "", "input * 2 + offset"};
+
+  void mainLoop() override {
+    static_assert(decltype(output)::size() == 4);
+    while(true) {
+      offset.read();
+      int32_t* out = output.begin();
+      for(size_t i = 0; i < output.size(); ++i) out[i] = 2 * input[i] + offset[i];
+      output.write();
+      input.read();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+
+  TestModule module{this, "module", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testReadWrite) {
+  std::cout << "testReadWrite" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.setArrayDefault<int32_t>("/module/offset", {1, 1, 1, 1});
+  test.runApplication();
+
+  BOOST_CHECK((test.readArray<int32_t>("/module/output") == std::vector<int32_t>{1, 1, 1, 1}));
+
+  test.writeArray<int32_t>("/module/input", {1, 2, 3, 4});
+  test.writeArray<int32_t>("/module/offset", {0, 10, 20, 30});
+  test.stepApplication();
+  BOOST_CHECK((test.readArray<int32_t>("/module/output") == std::vector<int32_t>{2, 14, 26, 38}));
+
+  // conversion from and to std::array
+  std::array<int32_t, 4> value = app.module.output;
+  BOOST_CHECK((value == std::array<int32_t, 4>{2, 14, 26, 38}));
+  app.module.output = std::array<int32_t, 4>{4, 3, 2, 1};
+  BOOST_CHECK_EQUAL(app.module.output[0], 4);
+  BOOST_CHECK_EQUAL(app.module.output[3], 1);
+}
+
+/*********************************************************************************************************************/
+
+struct MismatchModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+  ctk::ArrayPushInput<int32_t> input{this, "input", "", 3, "Input with a different size"};
+  void mainLoop() override {}
+};
+
+struct MismatchApplication : public ctk::Application {
+  MismatchApplication() : Application("testSuite") {}
+  ~MismatchApplication() override { shutdown(); }
+
+  void defineConnections() override { module.output >> mismatch.input; }
+
+  TestModule module{this, "module", ""};
+  MismatchModule mismatch{this, "mismatch", ""};
+};
+
+BOOST_AUTO_TEST_CASE(testSizeMismatch) {
+  std::cout << "testSizeMismatch" << std::endl;
+  MismatchApplication app;
+  BOOST_CHECK_THROW(ctk::TestFacility{}, ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
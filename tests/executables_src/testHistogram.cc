@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testHistogram
+
+#include "Application.h"
+#include "Histogram.h"
+#include "TestFacility.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+
+  ctk::Histogram<int32_t> hist{this, "Histogram", "", 4, 5};
+};
+
+/*********************************************************************************************************************/
+
+static std::vector<double> readHistogram(ctk::TestFacility& test) {
+  return test.readArray<double>("/Histogram/histogram");
+}
+
+/*********************************************************************************************************************/
+
+/* Let the histogram process the input and publish the result */
+static void publish(ctk::TestFacility& test) {
+  test.writeScalar<uint64_t>("/Histogram/trigger", 0);
+  test.stepApplication();
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testLinearBins) {
+  std::cout << "testLinearBins" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.setScalarDefault<double>("/Histogram/config/lowerLimit", 0.);
+  test.setScalarDefault<double>("/Histogram/config/upperLimit", 10.);
+  test.runApplication();
+
+  auto centres = test.readArray<double>("/Histogram/binCentres");
+  BOOST_CHECK((centres == std::vector<double>{1., 3., 5., 7., 9.}));
+
+  test.writeArray<int32_t>("/Histogram/input", {-1, 0, 5, 9});
+  publish(test);
+  // the initial value (all zeros) has been accumulated as well
+  BOOST_CHECK((readHistogram(test) == std::vector<double>{5., 0., 1., 0., 1.}));
+  BOOST_CHECK_EQUAL(test.readScalar<double>("/Histogram/underflow"), 1.);
+  BOOST_CHECK_EQUAL(test.readScalar<double>("/Histogram/overflow"), 0.);
+
+  test.writeArray<int32_t>("/Histogram/input", {10, 11, 2, 3});
+  publish(test);
+  BOOST_CHECK((readHistogram(test) == std::vector<double>{5., 2., 1., 0., 1.}));
+  BOOST_CHECK_EQUAL(test.readScalar<double>("/Histogram/overflow"), 2.);
+  BOOST_CHECK_EQUAL(test.readScalar<double>("/Histogram/nEntries"), 12.);
+
+  // changing the limits resets the histogram
+  test.writeScalar<double>("/Histogram/config/upperLimit", 5.);
+  test.writeArray<int32_t>("/Histogram/input", {0, 1, 2, 3});
+  publish(test);
+  BOOST_CHECK((readHistogram(test) == std::vector<double>{1., 1., 1., 1., 0.}));
+  BOOST_CHECK_EQUAL(test.readScalar<double>("/Histogram/nEntries"), 4.);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testLogarithmicBins) {
+  std::cout << "testLogarithmicBins" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.setScalarDefault<double>("/Histogram/config/lowerLimit", 1.);
+  test.setScalarDefault<double>("/Histogram/config/upperLimit", 100000.);
+  test.setScalarDefault<int32_t>("/Histogram/config/logarithmic", 1);
+  test.runApplication();
+
+  // initial value of 0 is in the underflow for logarithmic bins
+  BOOST_CHECK_EQUAL(test.readScalar<double>("/Histogram/underflow"), 4.);
+
+  test.writeArray<int32_t>("/Histogram/input", {1, 15, 150, 99999});
+  publish(test);
+  BOOST_CHECK((readHistogram(test) == std::vector<double>{1., 1., 1., 0., 1.}));
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testWindowedMode) {
+  std::cout << "testWindowedMode" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.setScalarDefault<double>("/Histogram/config/upperLimit", 10.);
+  test.setScalarDefault<uint32_t>("/Histogram/config/windowLength", 6);
+  test.runApplication();
+
+  test.writeArray<int32_t>("/Histogram/input", {9, 9, 9, 9});
+  publish(test);
+  // two of the initial zeros are still in the window
+  BOOST_CHECK((readHistogram(test) == std::vector<double>{2., 0., 0., 0., 4.}));
+
+  test.writeArray<int32_t>("/Histogram/input", {4, 4, 4, 4});
+  publish(test);
+  BOOST_CHECK((readHistogram(test) == std::vector<double>{0., 0., 4., 0., 2.}));
+  BOOST_CHECK_EQUAL(test.readScalar<double>("/Histogram/nEntries"), 6.);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDecayingMode) {
+  std::cout << "testDecayingMode" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.setScalarDefault<double>("/Histogram/config/upperLimit", 10.);
+  test.setScalarDefault<double>("/Histogram/config/decayFactor", 0.5);
+  test.runApplication();
+
+  test.writeArray<int32_t>("/Histogram/input", {9, 9, 9, 9});
+  publish(test);
+  auto hist = readHistogram(test);
+  BOOST_CHECK_CLOSE(hist[0], 2., 1e-9);
+  BOOST_CHECK_CLOSE(hist[4], 4., 1e-9);
+
+  test.writeArray<int32_t>("/Histogram/input", {9, 9, 9, 9});
+  publish(test);
+  hist = readHistogram(test);
+  BOOST_CHECK_CLOSE(hist[0], 1., 1e-9);
+  BOOST_CHECK_CLOSE(hist[4], 6., 1e-9);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testTriggeredPublication) {
+  std::cout << "testTriggeredPublication" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.setScalarDefault<double>("/Histogram/config/upperLimit", 10.);
+  test.runApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<double>("/Histogram/nEntries"), 4.);
+
+  // input updates are accumulated, but not published
+  test.writeArray<int32_t>("/Histogram/input", {9, 9, 9, 9});
+  test.stepApplication();
+  test.writeArray<int32_t>("/Histogram/input", {9, 9, 9, 9});
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<double>("/Histogram/nEntries"), 4.);
+
+  // the trigger publishes the histogram, also without new input values
+  test.writeScalar<uint64_t>("/Histogram/trigger", 1);
+  test.stepApplication();
+  BOOST_CHECK((readHistogram(test) == std::vector<double>{4., 0., 0., 0., 8.}));
+  test.writeScalar<uint64_t>("/Histogram/trigger", 2);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<double>("/Histogram/nEntries"), 12.);
+}
+
+/*********************************************************************************************************************/
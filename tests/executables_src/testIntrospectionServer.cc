@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testIntrospectionServer
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "CoalescingReadAnyGroup.h"
+#include "DeviceModule.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <regex>
+#include <thread>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+static const std::string socketPath = "/tmp/testIntrospectionServer." + std::to_string(getpid()) + ".sock";
+
+/*********************************************************************************************************************/
+
+/* Connect to the introspection socket and return the report */
+static std::string query() {
+  int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  BOOST_REQUIRE(fd >= 0);
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+  BOOST_REQUIRE(::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0);
+  std::string result;
+  char buffer[1024];
+  ssize_t n;
+  while((n = ::read(fd, buffer, sizeof(buffer))) > 0) result.append(buffer, size_t(n));
+  ::close(fd);
+  return result;
+}
+
+/*********************************************************************************************************************/
+
+struct TestModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int32_t> input{this, "input", "", ""};
+  ctk::ScalarOutput<int32_t> output{this, "output", "", ""};
+
+  void mainLoop() override {
+    while(true) {
+      output = int32_t(input);
+      output.write();
+      input.read();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct GroupModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int32_t> a{this, "a", "", ""};
+  ctk::ScalarPushInput<int32_t> b{this, "b", "", ""};
+
+  void mainLoop() override {
+    auto group = coalescingReadAnyGroup();
+    while(true) group.readAny();
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") { enableIntrospectionSocket(socketPath); }
+  ~TestApplication() override { shutdown(); }
+
+  ctk::DeviceModule dev{this, "(dummy?map=test.map)"};
+  TestModule module{this, "module", ""};
+  GroupModule group{this, "group", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testReport) {
+  std::cout << "testReport" << std::endl;
+  {
+    TestApplication app;
+    ctk::TestFacility test;
+    test.runApplication();
+
+    test.writeScalar<int32_t>("/module/input", 42);
+    test.stepApplication();
+
+    auto report = query();
+    // the module thread is waiting for the next value
+    BOOST_CHECK(report.find("AM_module\t/testSuite/module/input\n") != std::string::npos);
+    // the group module thread is waiting in CoalescingReadAnyGroup::readAny()
+    BOOST_CHECK(report.find("AM_group\treadAny(") != std::string::npos);
+    // initial value and one update have been transferred through both variables
+    BOOST_CHECK(std::regex_search(report, std::regex("\n/testSuite/module/input\t0\t[0-9]+\t2\tok\n")));
+    BOOST_CHECK(std::regex_search(report, std::regex("\n/testSuite/module/output\t0\t[0-9]+\t2\tok\n")));
+    // the device is functional
+    BOOST_CHECK(report.find("(dummy?map=test.map)\tfunctional\t0\n") != std::string::npos);
+
+    // terminated threads are removed from the report
+    std::thread shortLived([] { ctk::Application::registerThread("shortLived"); });
+    shortLived.join();
+    BOOST_CHECK(query().find("shortLived") == std::string::npos);
+
+    // enabling the socket is only possible before starting the application
+    BOOST_CHECK_THROW(app.enableIntrospectionSocket(socketPath), ctk::logic_error);
+  }
+
+  // the socket is removed on shutdown
+  BOOST_CHECK(::access(socketPath.c_str(), F_OK) != 0);
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testMemoryLocking
+
+#include "Application.h"
+#include "MemoryLocking.h"
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testFindRegions) {
+  std::cout << "testFindRegions" << std::endl;
+
+  std::stringstream maps;
+  // executable and heap
+  maps << "55d0c4a00000-55d0c4a20000 r-xp 00000000 fd:01 1234       /usr/bin/app\n";
+  maps << "55d0c5000000-55d0c5600000 rw-p 00000000 00:00 0          [heap]\n";
+  // large anonymous buffer
+  maps << "7f0000000000-7f0000800000 rw-p 00000000 00:00 0 \n";
+  // small anonymous buffer
+  maps << "7f0001000000-7f0001001000 rw-p 00000000 00:00 0\n";
+  // thread stack with guard page
+  maps << "7f0002000000-7f0002001000 ---p 00000000 00:00 0\n";
+  maps << "7f0002001000-7f0002801000 rw-p 00000000 00:00 0\n";
+  // reserved malloc arena (large guard-like mapping) followed by a large buffer
+  maps << "7f0003000000-7f0004000000 ---p 00000000 00:00 0\n";
+  maps << "7f0004000000-7f0004400000 rw-p 00000000 00:00 0\n";
+  // shared memory, writable file mapping and read-only anonymous mapping
+  maps << "7f0005000000-7f0005800000 rw-s 00000000 00:05 42         /dev/shm/buffer\n";
+  maps << "7f0006000000-7f0006800000 rw-p 00000000 fd:01 1235       /tmp/data\n";
+  maps << "7f0007000000-7f0007800000 r--p 00000000 00:00 0\n";
+  // main thread stack
+  maps << "7ffc00000000-7ffc00800000 rw-p 00000000 00:00 0          [stack]\n";
+
+  auto regions = ctk::MemoryLocking::findLargeAnonymousRegions(maps, 2 * 1024 * 1024);
+  BOOST_REQUIRE_EQUAL(regions.size(), 3);
+  BOOST_CHECK_EQUAL(regions[0].begin, 0x55d0c5000000);
+  BOOST_CHECK_EQUAL(regions[0].end, 0x55d0c5600000);
+  BOOST_CHECK_EQUAL(regions[1].begin, 0x7f0000000000);
+  BOOST_CHECK_EQUAL(regions[1].end, 0x7f0000800000);
+  BOOST_CHECK_EQUAL(regions[2].begin, 0x7f0004000000);
+  BOOST_CHECK_EQUAL(regions[2].end, 0x7f0004400000);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testFindLargeBuffer) {
+  std::cout << "testFindLargeBuffer" << std::endl;
+
+  // a large array buffer is found in the real memory map of the process
+  std::vector<float> buffer(16 * 1024 * 1024);
+  auto address = reinterpret_cast<uintptr_t>(buffer.data());
+
+  std::ifstream maps("/proc/self/maps");
+  auto regions = ctk::MemoryLocking::findLargeAnonymousRegions(maps, 2 * 1024 * 1024);
+  bool found = false;
+  for(auto& region : regions) {
+    if(address >= region.begin && address + buffer.size() * sizeof(float) <= region.end) found = true;
+  }
+  BOOST_CHECK(found);
+
+  // advising is best effort, but must never fail if huge pages are available
+  auto hugePageSize = ctk::MemoryLocking::getHugePageSize();
+  if(hugePageSize > 0) {
+    BOOST_CHECK(ctk::MemoryLocking::adviseHugePages(regions, hugePageSize) >= hugePageSize);
+  }
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testEnableAfterRun) {
+  std::cout << "testEnableAfterRun" << std::endl;
+  TestApplication app;
+  app.enableMemoryLocking();
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+  BOOST_CHECK_THROW(app.enableMemoryLocking(false), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
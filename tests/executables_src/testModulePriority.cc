@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testModulePriority
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "FeedingFanOut.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+#include "VariableGroup.h"
+
+#include <ChimeraTK/ControlSystemAdapter/ProcessArray.h>
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+
+#include <boost/test/included/unit_test.hpp>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct TestModule : public ctk::ApplicationModule {
+  TestModule(EntityOwner* owner, const std::string& name, ctk::ModulePriority priority)
+  : ctk::ApplicationModule(owner, name, "") {
+    if(priority != ctk::ModulePriority::normal) setPriority(priority);
+  }
+  TestModule() { throw; } // work around for gcc bug: constructor must be present but is unused
+
+  ctk::ScalarPushInput<int> input{this, "input", "", ""};
+
+  struct : ctk::VariableGroup {
+    using ctk::VariableGroup::VariableGroup;
+    ctk::ScalarPushInput<int> input{this, "input", "", ""};
+  } group{this, "group", ""};
+
+  ctk::ScalarOutput<int> output{this, "output", "", ""};
+
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+
+  void defineConnections() override { findTag(".*").connectTo(cs); }
+
+  ctk::ControlSystemModule cs;
+
+  TestModule low{this, "low", ctk::ModulePriority::low};
+  TestModule normal{this, "normal", ctk::ModulePriority::normal};
+  TestModule high{this, "high", ctk::ModulePriority::high};
+  TestModule realtime{this, "realtime", ctk::ModulePriority::realtime};
+};
+
+/*********************************************************************************************************************/
+
+/** Expose the slaves of the FeedingFanOut */
+struct TestFanOut : public ctk::FeedingFanOut<int> {
+  using ctk::FeedingFanOut<int>::FeedingFanOut;
+  using ctk::FanOut<int>::slaves;
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testNodePriority) {
+  std::cout << "testNodePriority" << std::endl;
+  TestApplication app;
+
+  BOOST_CHECK(app.low.getPriority() == ctk::ModulePriority::low);
+  BOOST_CHECK(app.normal.getPriority() == ctk::ModulePriority::normal);
+  BOOST_CHECK(ctk::VariableNetworkNode(app.high.input).getPriority() == ctk::ModulePriority::high);
+  BOOST_CHECK(ctk::VariableNetworkNode(app.realtime.group.input).getPriority() == ctk::ModulePriority::realtime);
+  BOOST_CHECK(app.cs("someVariable", typeid(int), 1).getPriority() == ctk::ModulePriority::normal);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testSlaveOrder) {
+  std::cout << "testSlaveOrder" << std::endl;
+  TestApplication app;
+
+  // add the slaves in the order of increasing priority
+  ctk::ConsumerImplementationPairs<int> consumers;
+  for(auto* module : {&app.low, &app.normal, &app.high, &app.realtime}) {
+    for(auto* input : {&module->input, &module->group.input}) {
+      auto pvars = ctk::createSynchronizedProcessArray<int>(
+          1, module->getName(), "", "", {}, 3, {ctk::AccessMode::wait_for_new_data});
+      consumers.emplace_back(pvars.first, ctk::VariableNetworkNode(*input));
+    }
+  }
+
+  TestFanOut fanOut("fanOut", "", "", 1, false, consumers);
+  BOOST_CHECK(fanOut.getHighestSlavePriority() == ctk::ModulePriority::realtime);
+
+  // slaves of higher priority come first, slaves of the same priority keep their order
+  std::vector<std::string> names;
+  for(auto& slave : fanOut.slaves) names.push_back(slave->getName());
+  std::vector<std::string> expected{"realtime", "realtime", "high", "high", "normal", "normal", "low", "low"};
+  BOOST_REQUIRE_EQUAL(names.size(), expected.size());
+  for(size_t i = 0; i < names.size(); ++i) {
+    BOOST_CHECK_MESSAGE(names[i].find(expected[i]) != std::string::npos, names[i] + " != " + expected[i]);
+  }
+
+  // removing the only realtime slaves lowers the highest priority
+  std::vector<boost::shared_ptr<ctk::NDRegisterAccessor<int>>> realtimeSlaves(
+      fanOut.slaves.begin(), std::next(fanOut.slaves.begin(), 2));
+  for(auto& slave : realtimeSlaves) fanOut.removeSlave(slave);
+  BOOST_CHECK(fanOut.getHighestSlavePriority() == ctk::ModulePriority::high);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testSetPriorityAfterInitialisation) {
+  std::cout << "testSetPriorityAfterInitialisation" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.runApplication();
+
+  BOOST_CHECK_THROW(app.normal.setPriority(ctk::ModulePriority::high), ctk::logic_error);
+  BOOST_CHECK(app.normal.getPriority() == ctk::ModulePriority::normal);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testSetPriorityAfterConnecting) {
+  std::cout << "testSetPriorityAfterConnecting" << std::endl;
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+
+  // the connections are already made, so the priority can no longer be changed even though run() was not called
+  BOOST_CHECK_THROW(app.normal.setPriority(ctk::ModulePriority::high), ctk::logic_error);
+  BOOST_CHECK(app.normal.getPriority() == ctk::ModulePriority::normal);
+}
+
+/*********************************************************************************************************************/
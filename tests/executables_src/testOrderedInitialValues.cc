@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testOrderedInitialValues
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ScalarAccessor.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+using namespace std::chrono_literals;
+
+/*********************************************************************************************************************/
+
+/* Writes a preliminary initial value in prepare() and the final one in its mainLoop() */
+struct Source : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> trigger{this, "trigger", "", ""};
+  ctk::ScalarOutput<int> output{this, "output", "", ""};
+
+  void prepare() override {
+    output = -10;
+    writeAll();
+  }
+
+  void mainLoop() override {
+    std::this_thread::sleep_for(20ms);
+    output = 0;
+    writeAll();
+    while(true) trigger.read();
+  }
+};
+
+/*********************************************************************************************************************/
+
+/* Computes output = input + 1, also with a preliminary initial value written in prepare() */
+struct Stage : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> input{this, "input", "", ""};
+  ctk::ScalarOutput<int> output{this, "output", "", ""};
+
+  std::atomic<size_t> nComputations{0};
+  std::atomic<int> lastOutput{-100};
+
+  void prepare() override {
+    output = -10;
+    writeAll();
+  }
+
+  void mainLoop() override {
+    while(true) {
+      output = input + 1;
+      ++nComputations;
+      lastOutput = int(output);
+      writeAll();
+      input.read();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") { enableOrderedInitialValues(5000ms); }
+  ~TestApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    source.output >> first.input;
+    first.output >> second.input;
+  }
+
+  Source source{this, "Source", ""};
+  Stage first{this, "First", ""};
+  Stage second{this, "Second", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testOrder) {
+  std::cout << "testOrder" << std::endl;
+  TestApplication app;
+  app.initialise();
+  app.run();
+
+  for(size_t i = 0; i < 1000 && app.second.lastOutput != 2; ++i) std::this_thread::sleep_for(1ms);
+  BOOST_CHECK_EQUAL(int(app.second.lastOutput), 2);
+
+  // give any superfluous recomputation the chance to happen
+  std::this_thread::sleep_for(50ms);
+
+  // each module computes only once, with the final values of the upstream modules
+  BOOST_CHECK_EQUAL(size_t(app.first.nComputations), 1);
+  BOOST_CHECK_EQUAL(size_t(app.second.nComputations), 1);
+  BOOST_CHECK_EQUAL(int(app.first.lastOutput), 1);
+  BOOST_CHECK_EQUAL(int(app.second.lastOutput), 2);
+
+  // the values written in prepare() have been skipped
+  BOOST_CHECK_EQUAL(app.getNumberOfSupersededInitialValues(), 2);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testIllegalUse) {
+  std::cout << "testIllegalUse" << std::endl;
+  TestApplication app;
+  BOOST_CHECK_THROW(app.enableOrderedInitialValues(0ms), ctk::logic_error);
+  app.initialise();
+  app.run();
+  BOOST_CHECK_THROW(app.enableOrderedInitialValues(), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
+
+/* Writes its initial value only in prepare(), so downstream modules wait in vain */
+struct Silent : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> trigger{this, "trigger", "", ""};
+  ctk::ScalarOutput<int> output{this, "output", "", ""};
+
+  void prepare() override { writeAll(); }
+
+  void mainLoop() override {
+    while(true) trigger.read();
+  }
+};
+
+/*********************************************************************************************************************/
+
+/* Two inputs fed by silent modules */
+struct Sink : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> input1{this, "input1", "", ""};
+  ctk::ScalarPushInput<int> input2{this, "input2", "", ""};
+
+  std::atomic<bool> mainLoopStarted{false};
+
+  void mainLoop() override {
+    mainLoopStarted = true;
+    while(true) input1.read();
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct SilentApplication : public ctk::Application {
+  SilentApplication() : Application("testSuite") { enableOrderedInitialValues(500ms); }
+  ~SilentApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    silent1.output >> sink.input1;
+    silent2.output >> sink.input2;
+  }
+
+  Silent silent1{this, "Silent1", ""};
+  Silent silent2{this, "Silent2", ""};
+  Sink sink{this, "Sink", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testSharedDeadline) {
+  std::cout << "testSharedDeadline" << std::endl;
+  SilentApplication app;
+  app.initialise();
+  auto start = std::chrono::steady_clock::now();
+  app.run();
+
+  for(size_t i = 0; i < 5000 && !app.sink.mainLoopStarted; ++i) std::this_thread::sleep_for(1ms);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  BOOST_CHECK(app.sink.mainLoopStarted);
+
+  // the module waits once for maxWait, not once per input
+  BOOST_CHECK(elapsed >= 500ms);
+  BOOST_CHECK(elapsed < 900ms);
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testPartialArrayWrite
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ArrayAccessor.h"
+#include "check_timeout.h"
+#include "ControlSystemModule.h"
+#include "DeviceModule.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+
+#include <ChimeraTK/Device.h>
+#include <ChimeraTK/ExceptionDummyBackend.h>
+
+#include <boost/test/included/unit_test.hpp>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+static constexpr char deviceCDD[] = "(dummy?map=test5.map)";
+static constexpr char exceptionDeviceCDD[] = "(ExceptionDummy?map=test5.map)";
+
+/*********************************************************************************************************************/
+
+struct TestModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int32_t> index{this, "index", "", "Index of the element to modify"};
+  ctk::ArrayOutput<int32_t> array{this, "array", "", 4, "Array with partial updates"};
+
+  void mainLoop() override {
+    for(size_t i = 0; i < 4; ++i) array[i] = int32_t(i + 1);
+    array.write();
+
+    while(true) {
+      index.read();
+      // Modify and mark the element at the given index. The last element is modified as well without marking it, so
+      // it is not written to the device registers (but still sent to the other consumers).
+      array[index] += 10;
+      array.markDirty(index);
+      array[3] = -1;
+      array.write();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+
+  ctk::ControlSystemModule cs;
+  ctk::DeviceModule dev{this, deviceCDD};
+  TestModule module{this, "TEST", "The test module"};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDirectConnection) {
+  std::cout << "testDirectConnection" << std::endl;
+  TestApplication app;
+  app.module.array >> app.dev("/TEST/TO_DEV_ARRAY1");
+  app.cs("index") >> app.module.index;
+
+  ctk::TestFacility test;
+  test.runApplication();
+
+  ctk::Device device;
+  device.open(deviceCDD);
+  BOOST_CHECK((device.read<int32_t>("/TEST/TO_DEV_ARRAY1", 4) == std::vector<int32_t>{1, 2, 3, 4}));
+
+  test.writeScalar<int32_t>("/index", 1);
+  test.stepApplication();
+  BOOST_CHECK((device.read<int32_t>("/TEST/TO_DEV_ARRAY1", 4) == std::vector<int32_t>{1, 12, 3, 4}));
+
+  test.writeScalar<int32_t>("/index", 2);
+  test.stepApplication();
+  BOOST_CHECK((device.read<int32_t>("/TEST/TO_DEV_ARRAY1", 4) == std::vector<int32_t>{1, 12, 13, 4}));
+
+  BOOST_CHECK_THROW(app.module.array.markDirty(2, 3), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testFanOut) {
+  std::cout << "testFanOut" << std::endl;
+  TestApplication app;
+  app.module.array >> app.dev("/TEST/TO_DEV_ARRAY1") >> app.dev("/TEST/TO_DEV_ARRAY2") >> app.cs("array");
+  app.cs("index") >> app.module.index;
+
+  ctk::TestFacility test;
+  test.runApplication();
+
+  ctk::Device device;
+  device.open(deviceCDD);
+  BOOST_CHECK((device.read<int32_t>("/TEST/TO_DEV_ARRAY1", 4) == std::vector<int32_t>{1, 2, 3, 4}));
+  BOOST_CHECK((device.read<int32_t>("/TEST/TO_DEV_ARRAY2", 4) == std::vector<int32_t>{1, 2, 3, 4}));
+  BOOST_CHECK((test.readArray<int32_t>("/array") == std::vector<int32_t>{1, 2, 3, 4}));
+
+  test.writeScalar<int32_t>("/index", 0);
+  test.stepApplication();
+  BOOST_CHECK((device.read<int32_t>("/TEST/TO_DEV_ARRAY1", 4) == std::vector<int32_t>{11, 2, 3, 4}));
+  BOOST_CHECK((device.read<int32_t>("/TEST/TO_DEV_ARRAY2", 4) == std::vector<int32_t>{11, 2, 3, 4}));
+  // the control system receives the full array
+  BOOST_CHECK((test.readArray<int32_t>("/array") == std::vector<int32_t>{11, 2, 3, -1}));
+
+  // marking the whole array writes everything
+  app.module.array.markAllDirty();
+  test.writeScalar<int32_t>("/index", 1);
+  test.stepApplication();
+  BOOST_CHECK((device.read<int32_t>("/TEST/TO_DEV_ARRAY1", 4) == std::vector<int32_t>{11, 12, 3, -1}));
+  BOOST_CHECK((device.read<int32_t>("/TEST/TO_DEV_ARRAY2", 4) == std::vector<int32_t>{11, 12, 3, -1}));
+}
+
+/*********************************************************************************************************************/
+
+struct RecoveryModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int32_t> trigger{this, "trigger", "", "Trigger for the next partial update"};
+  ctk::ArrayOutput<int32_t> array{this, "array", "", 4, "Array with partial updates"};
+
+  void mainLoop() override {
+    // already the initial value marks only a single element
+    for(size_t i = 0; i < 4; ++i) array[i] = int32_t(i + 1);
+    array.markDirty(1);
+    array.write();
+
+    while(true) {
+      trigger.read();
+      array[0] += 10;
+      array.markDirty(0);
+      array.write();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct RecoveryApplication : public ctk::Application {
+  RecoveryApplication() : Application("testSuite") {}
+  ~RecoveryApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    module.array >> dev("/TEST/TO_DEV_ARRAY1");
+    cs("trigger") >> module.trigger;
+  }
+
+  ctk::ControlSystemModule cs;
+  ctk::DeviceModule dev{this, exceptionDeviceCDD};
+  RecoveryModule module{this, "TEST", "The test module"};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testRecovery) {
+  std::cout << "testRecovery" << std::endl;
+  RecoveryApplication app;
+
+  // no testable mode, since the device has to recover in the background
+  ctk::TestFacility test(false);
+  test.writeScalar<int32_t>("/trigger", 0);
+  app.run();
+
+  ctk::Device device;
+  device.open(exceptionDeviceCDD);
+  auto dummyBackend = boost::dynamic_pointer_cast<ctk::ExceptionDummy>(
+      ctk::BackendFactory::getInstance().createBackend(exceptionDeviceCDD));
+  auto status = ctk::RegisterPath("/Devices") / exceptionDeviceCDD / "status";
+  CHECK_EQUAL_TIMEOUT(test.readScalar<int32_t>(status), 0, 10000);
+
+  // the first write is complete, although only a single element has been marked
+  CHECK_TIMEOUT((device.read<int32_t>("/TEST/TO_DEV_ARRAY1", 4) == std::vector<int32_t>{1, 2, 3, 4}), 10000);
+
+  // let the next partial write fail
+  device.write("/TEST/TO_DEV_ARRAY1", std::vector<int32_t>{0, 0, 0, 0});
+  dummyBackend->throwExceptionWrite = true;
+  test.writeScalar<int32_t>("/trigger", 1);
+  CHECK_EQUAL_TIMEOUT(test.readScalar<int32_t>(status), 1, 10000);
+
+  // the recovery restores the whole array, including the elements which have never been marked
+  dummyBackend->throwExceptionWrite = false;
+  CHECK_EQUAL_TIMEOUT(test.readScalar<int32_t>(status), 0, 10000);
+  BOOST_CHECK((device.read<int32_t>("/TEST/TO_DEV_ARRAY1", 4) == std::vector<int32_t>{11, 2, 3, 4}));
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testReadSpinning
+
+#include "AdaptiveSpinWait.h"
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "CoalescingReadAnyGroup.h"
+#include "MetaDataPropagatingRegisterDecorator.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <chrono>
+#include <thread>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+using namespace std::chrono_literals;
+
+/*********************************************************************************************************************/
+
+struct TestModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> pushInput{this, "pushInput", "", ""};
+  ctk::ScalarPushInput<int> excludedInput{this, "excludedInput", "", ""};
+  ctk::ScalarPollInput<int> pollInput{this, "pollInput", "", ""};
+  ctk::ScalarOutput<int> output{this, "output", "", ""};
+
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {
+    spinning.setReadSpinTime(10us);
+    spinning.excludedInput.setReadSpinTime(0us);
+    notSpinning.pushInput.setReadSpinTime(5us);
+  }
+  ~TestApplication() override { shutdown(); }
+
+  TestModule spinning{this, "spinning", ""};
+  TestModule notSpinning{this, "notSpinning", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testConfiguration) {
+  std::cout << "testConfiguration" << std::endl;
+  TestApplication app;
+
+  // the setting of the module applies to all push-type inputs, unless overridden for an input
+  BOOST_CHECK(ctk::VariableNetworkNode(app.spinning.pushInput).getReadSpinTime() == 10us);
+  BOOST_CHECK(ctk::VariableNetworkNode(app.spinning.excludedInput).getReadSpinTime() == 0us);
+  BOOST_CHECK(ctk::VariableNetworkNode(app.spinning.pollInput).getReadSpinTime() == 0us);
+  BOOST_CHECK(ctk::VariableNetworkNode(app.spinning.output).getReadSpinTime() == 0us);
+
+  // disabled by default
+  BOOST_CHECK(app.notSpinning.getReadSpinTime() == 0us);
+  BOOST_CHECK(ctk::VariableNetworkNode(app.notSpinning.excludedInput).getReadSpinTime() == 0us);
+  BOOST_CHECK(ctk::VariableNetworkNode(app.notSpinning.pushInput).getReadSpinTime() == 5us);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDecorator) {
+  std::cout << "testDecorator" << std::endl;
+  TestApplication app;
+  // no testable mode, since it disables spinning
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+
+  // the spinning is done by the single decorator of the application accessor
+  auto getSpinWait = [](ctk::ScalarPushInput<int>& input) {
+    auto decorator = boost::dynamic_pointer_cast<ctk::MetaDataPropagatingRegisterDecorator<int>>(
+        input.getHighLevelImplElement());
+    BOOST_REQUIRE(decorator);
+    return decorator->getSpinWait();
+  };
+  BOOST_CHECK(getSpinWait(app.spinning.pushInput) != nullptr);
+  BOOST_CHECK(getSpinWait(app.spinning.excludedInput) == nullptr);
+  BOOST_CHECK(getSpinWait(app.notSpinning.pushInput) != nullptr);
+  BOOST_CHECK(getSpinWait(app.notSpinning.excludedInput) == nullptr);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testCoalescingReadAnyGroup) {
+  std::cout << "testCoalescingReadAnyGroup" << std::endl;
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+
+  // the group spins as a whole with the read spin time of the module, since the ReadAnyGroup waits for its
+  // notification queue before reading any element (so the spinning of the individual inputs never applies)
+  auto spinningGroup = app.spinning.coalescingReadAnyGroup();
+  BOOST_REQUIRE(spinningGroup.getSpinWait() != nullptr);
+  auto notSpinningGroup = app.notSpinning.coalescingReadAnyGroup();
+  BOOST_CHECK(notSpinningGroup.getSpinWait() == nullptr);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testTestableMode) {
+  std::cout << "testTestableMode" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+
+  // spinning is disabled in testable mode, and cannot be changed after initialisation
+  BOOST_CHECK(ctk::VariableNetworkNode(app.spinning.pushInput).getReadSpinTime() == 0us);
+  test.runApplication();
+  BOOST_CHECK_THROW(app.spinning.setReadSpinTime(1us), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testAdaptiveSpinWait) {
+  std::cout << "testAdaptiveSpinWait" << std::endl;
+  cppext::future_queue<void> queue(3);
+  ctk::AdaptiveSpinWait spinWait(10us);
+
+  // no spinning without an estimate of the inter-arrival time
+  BOOST_CHECK(!spinWait.wait(queue));
+  spinWait.arrived();
+  BOOST_CHECK(!spinWait.wait(queue));
+  BOOST_CHECK(spinWait.getTypicalInterval() == 0ns);
+
+  // learn an inter-arrival time which is much longer than the spin budget
+  for(size_t i = 0; i < 10; ++i) {
+    std::this_thread::sleep_for(2ms);
+    spinWait.arrived();
+  }
+  BOOST_CHECK(spinWait.getTypicalInterval() >= 2ms);
+
+  // the next value is not expected within the spin budget: no spinning
+  BOOST_CHECK(!spinWait.wait(queue));
+  BOOST_CHECK_EQUAL(spinWait.getSpinHits(), 0);
+  BOOST_CHECK_EQUAL(spinWait.getSpinMisses(), 0);
+
+  // data already present: the read will not block
+  queue.push();
+  BOOST_CHECK(spinWait.wait(queue));
+  BOOST_CHECK_EQUAL(spinWait.getSpinHits(), 0);
+
+  // the same with a predicate instead of a queue, which is evaluated only once if spinning is not worth it
+  size_t nCalls = 0;
+  BOOST_CHECK(!spinWait.waitUntil([&] { return ++nCalls > 1; }));
+  BOOST_CHECK_EQUAL(nCalls, 1);
+  BOOST_CHECK(spinWait.waitUntil([] { return true; }));
+  BOOST_CHECK_EQUAL(spinWait.getSpinHits(), 0);
+}
+
+/*********************************************************************************************************************/
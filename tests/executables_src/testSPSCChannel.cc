@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testSPSCChannel
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ArrayAccessor.h"
+#include "ControlSystemModule.h"
+#include "ScalarAccessor.h"
+#include "SPSCChannel.h"
+#include "TestFacility.h"
+
+#include <ChimeraTK/OneDRegisterAccessor.h>
+#include <ChimeraTK/ScalarRegisterAccessor.h>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <thread>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testTransfer) {
+  std::cout << "testTransfer" << std::endl;
+  auto pair = ctk::createSPSCChannel<int32_t>(3, "channel", "unit", "desc", 3, {ctk::AccessMode::wait_for_new_data});
+  ctk::OneDRegisterAccessor<int32_t> sender(pair.first);
+  ctk::OneDRegisterAccessor<int32_t> receiver(pair.second);
+
+  BOOST_CHECK(sender.isWriteable());
+  BOOST_CHECK(!sender.isReadable());
+  BOOST_CHECK(receiver.isReadable());
+  BOOST_CHECK(receiver.isReadOnly());
+  BOOST_CHECK_EQUAL(receiver.getNElements(), 3);
+  BOOST_CHECK(!receiver.readNonBlocking());
+
+  sender = std::vector<int32_t>{1, 2, 3};
+  ctk::VersionNumber version;
+  BOOST_CHECK(!sender.write(version));
+  BOOST_CHECK(receiver.readNonBlocking());
+  BOOST_CHECK((std::vector<int32_t>(receiver) == std::vector<int32_t>{1, 2, 3}));
+  BOOST_CHECK(receiver.getVersionNumber() == version);
+  BOOST_CHECK(receiver.dataValidity() == ctk::DataValidity::ok);
+  BOOST_CHECK(!receiver.readNonBlocking());
+
+  // the data validity is transported
+  sender.setDataValidity(ctk::DataValidity::faulty);
+  sender = std::vector<int32_t>{4, 5, 6};
+  sender.writeDestructively();
+  receiver.read();
+  BOOST_CHECK((std::vector<int32_t>(receiver) == std::vector<int32_t>{4, 5, 6}));
+  BOOST_CHECK(receiver.dataValidity() == ctk::DataValidity::faulty);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testOverflow) {
+  std::cout << "testOverflow" << std::endl;
+  auto pair = ctk::createSPSCChannel<int32_t>(1, "channel", "", "", 3, {ctk::AccessMode::wait_for_new_data});
+  ctk::ScalarRegisterAccessor<int32_t> sender(pair.first);
+  ctk::ScalarRegisterAccessor<int32_t> receiver(pair.second);
+
+  // fill the queue, further writes overwrite the most recent value
+  for(int32_t i = 1; i <= 3; ++i) {
+    sender = i;
+    BOOST_CHECK(!sender.write());
+  }
+  sender = 4;
+  BOOST_CHECK(sender.write());
+  sender = 5;
+  BOOST_CHECK(sender.write());
+
+  std::vector<int32_t> received;
+  while(receiver.readNonBlocking()) received.push_back(receiver);
+  BOOST_CHECK((received == std::vector<int32_t>{1, 2, 5}));
+
+  // readLatest consumes everything and returns the most recent value
+  for(int32_t i = 6; i <= 8; ++i) {
+    sender = i;
+    sender.write();
+  }
+  BOOST_CHECK(receiver.readLatest());
+  BOOST_CHECK_EQUAL(int32_t(receiver), 8);
+  BOOST_CHECK(!receiver.readNonBlocking());
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testThreads) {
+  std::cout << "testThreads" << std::endl;
+  auto pair = ctk::createSPSCChannel<int32_t>(1, "channel", "", "", 3, {ctk::AccessMode::wait_for_new_data});
+  auto pairBack = ctk::createSPSCChannel<int32_t>(1, "back", "", "", 3, {ctk::AccessMode::wait_for_new_data});
+  ctk::ScalarRegisterAccessor<int32_t> sender(pair.first), receiverBack(pairBack.second);
+  ctk::ScalarRegisterAccessor<int32_t> receiver(pair.second), senderBack(pairBack.first);
+
+  // ping-pong: no data may get lost or reordered
+  std::thread echo([&] {
+    while(true) {
+      receiver.read();
+      senderBack = int32_t(receiver);
+      senderBack.write();
+      if(receiver == -1) return;
+    }
+  });
+  for(int32_t i = 0; i < 10000; ++i) {
+    sender = i;
+    BOOST_REQUIRE(!sender.write());
+    receiverBack.read();
+    BOOST_REQUIRE_EQUAL(int32_t(receiverBack), i);
+  }
+  sender = -1;
+  sender.write();
+  echo.join();
+
+  // a blocking read can be interrupted
+  std::thread blocked([&] { BOOST_CHECK_THROW(receiverBack.read(), boost::thread_interrupted); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  pairBack.second->interrupt();
+  blocked.join();
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInterruptFullQueue) {
+  std::cout << "testInterruptFullQueue" << std::endl;
+  auto pair = ctk::createSPSCChannel<int32_t>(1, "channel", "", "", 3, {ctk::AccessMode::wait_for_new_data});
+  ctk::ScalarRegisterAccessor<int32_t> sender(pair.first);
+  ctk::ScalarRegisterAccessor<int32_t> receiver(pair.second);
+
+  // an interrupt of a receiver with a full queue must not replace any of the values
+  for(int32_t i = 1; i <= 3; ++i) {
+    sender = i;
+    sender.write();
+  }
+  pair.second->interrupt();
+  pair.second->interrupt(); // only one interrupt is queued
+  std::vector<int32_t> received;
+  for(size_t i = 0; i < 3; ++i) {
+    BOOST_CHECK(receiver.readNonBlocking());
+    received.push_back(receiver);
+  }
+  BOOST_CHECK((received == std::vector<int32_t>{1, 2, 3}));
+  BOOST_CHECK_THROW(receiver.readNonBlocking(), boost::thread_interrupted);
+  BOOST_CHECK(!receiver.readNonBlocking());
+
+  // the number of notifications is still in sync with the values
+  for(int32_t i = 4; i <= 6; ++i) {
+    sender = i;
+    BOOST_CHECK(!sender.write());
+  }
+  sender = 7;
+  BOOST_CHECK(sender.write());
+  received.clear();
+  while(receiver.readNonBlocking()) received.push_back(receiver);
+  BOOST_CHECK((received == std::vector<int32_t>{4, 5, 7}));
+}
+
+/*********************************************************************************************************************/
+
+struct Doubler : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+  ctk::ArrayPushInput<int32_t> input{this, "input", "", 2, ""};
+  ctk::ArrayOutput<int32_t> output{this, "output", "", 2, ""};
+
+  void mainLoop() override {
+    while(true) {
+      for(size_t i = 0; i < 2; ++i) output[i] = 2 * input[i];
+      output.writeDestructively();
+      input.read();
+    }
+  }
+};
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+
+  // first.output -> second.input is a 1:1 connection, the remaining variables are published to the control system.
+  // The base class implementation is not used, since it would publish first.output as well.
+  void defineConnections() override {
+    ctk::ControlSystemModule cs;
+    first.output >> second.input;
+    cs["first"]("input") >> first.input;
+    second.output >> cs["second"]("output");
+  }
+
+  Doubler first{this, "first", ""};
+  Doubler second{this, "second", ""};
+};
+
+BOOST_AUTO_TEST_CASE(testApplication) {
+  std::cout << "testApplication" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.runApplication();
+
+  // the SPSC channel is used for the 1:1 connection
+  bool foundReceiver = false;
+  for(auto& element : app.second.input.getHighLevelImplElement()->getInternalElements()) {
+    if(boost::dynamic_pointer_cast<ctk::SPSCReceiver<int32_t>>(element)) foundReceiver = true;
+  }
+  BOOST_CHECK(foundReceiver);
+
+  test.writeArray<int32_t>("/first/input", {1, 2});
+  test.stepApplication();
+  BOOST_CHECK((test.readArray<int32_t>("/second/output") == std::vector<int32_t>{4, 8}));
+
+  test.writeArray<int32_t>("/first/input", {-3, 5});
+  test.stepApplication();
+  BOOST_CHECK((test.readArray<int32_t>("/second/output") == std::vector<int32_t>{-12, 20}));
+}
+
+/*********************************************************************************************************************/
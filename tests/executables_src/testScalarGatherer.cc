@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testScalarGatherer
+
+#include "Application.h"
+#include "ScalarGatherer.h"
+#include "TestFacility.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+/* Module passing its input through to the output, so the test can control the gathered outputs */
+struct PassThrough : ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<double> in{this, "in", "degC", "Input"};
+  ctk::ScalarOutput<double> temperature{this, "temperature", "degC", "Gathered output", {"GATHER"}};
+  ctk::ScalarOutput<double> other{this, "other", "degC", "Not gathered output"};
+
+  void mainLoop() override {
+    while(true) {
+      temperature = double(in);
+      other = double(in);
+      writeAll();
+      in.read();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+
+  PassThrough a{this, "A", ""};
+  PassThrough b{this, "B", ""};
+  PassThrough c{this, "C", ""};
+
+  ctk::ScalarGatherer<double> gatherer{this, "Gatherer", "", "GATHER"};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testGather) {
+  std::cout << "testGather" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.runApplication();
+
+  auto names = test.readArray<std::string>("/Gatherer/names");
+  BOOST_CHECK((names == std::vector<std::string>{"/testSuite/A/temperature", "/testSuite/B/temperature",
+                           "/testSuite/C/temperature"}));
+
+  auto values = test.getArray<double>("/Gatherer/values");
+  auto changed = test.getArray<int32_t>("/Gatherer/changed");
+  values.readLatest();
+  changed.readLatest();
+
+  test.writeScalar<double>("/B/in", 42.);
+  test.stepApplication();
+  BOOST_CHECK(values.readNonBlocking());
+  BOOST_CHECK(changed.readNonBlocking());
+  BOOST_CHECK((std::vector<double>(values) == std::vector<double>{0., 42., 0.}));
+  BOOST_CHECK((std::vector<int32_t>(changed) == std::vector<int32_t>{0, 1, 0}));
+  BOOST_CHECK(!values.readNonBlocking());
+
+  test.writeScalar<double>("/A/in", 1.);
+  test.writeScalar<double>("/C/in", 3.);
+  test.stepApplication();
+  values.readLatest();
+  changed.readLatest();
+  BOOST_CHECK((std::vector<double>(values) == std::vector<double>{1., 42., 3.}));
+}
+
+/*********************************************************************************************************************/
+
+/* Updates arriving faster than minPeriod are published together. Not in testable mode, since the test needs to send
+ * updates while the ScalarGatherer waits for the period to elapse. */
+BOOST_AUTO_TEST_CASE(testRateLimit) {
+  std::cout << "testRateLimit" << std::endl;
+  std::chrono::steady_clock::time_point shutdownStart;
+  {
+    TestApplication app;
+    ctk::TestFacility test(false);
+    test.setScalarDefault<uint32_t>("/Gatherer/minPeriod", 1000);
+    test.runApplication();
+
+    auto values = test.getArray<double>("/Gatherer/values");
+    auto changed = test.getArray<int32_t>("/Gatherer/changed");
+    values.read();
+    changed.read();
+
+    test.writeScalar<double>("/A/in", 1.);
+    test.writeScalar<double>("/B/in", 2.);
+    test.writeScalar<double>("/C/in", 3.);
+    values.read();
+    changed.read();
+    BOOST_CHECK((std::vector<double>(values) == std::vector<double>{1., 2., 3.}));
+    BOOST_CHECK((std::vector<int32_t>(changed) == std::vector<int32_t>{1, 1, 1}));
+    usleep(1200000);
+    BOOST_CHECK(!values.readNonBlocking());
+
+    // the ScalarGatherer can be terminated while waiting for the period to elapse
+    test.writeScalar<uint32_t>("/Gatherer/minPeriod", 100000);
+    test.writeScalar<double>("/A/in", 4.);
+    usleep(100000);
+    shutdownStart = std::chrono::steady_clock::now();
+  }
+  BOOST_CHECK(std::chrono::steady_clock::now() - shutdownStart < std::chrono::seconds(10));
+}
+
+/*********************************************************************************************************************/
@@ -129,3 +129,46 @@ BOOST_FIXTURE_TEST_CASE(testError, Fixture) {
   (void)std::filesystem::remove("device1Init.success");
   (void)std::filesystem::remove("continueDevice1Init");
 }
+
+struct TimeoutTestApp : public Application {
+  using Application::Application;
+  ~TimeoutTestApp() { shutdown(); }
+
+  ConnectingDeviceModule dev{this, "Dummy1", "/MyModule/actuator"};
+
+  // the script never finishes within the timeout of 1 second. Shorten the error grace time to 1 second
+  ScriptedInitHandler initHandler{this, "InitHander", "description", "./deviceInitScript3.bash",
+      dev.getDeviceModule(), "initScriptOutput", 1, 1};
+};
+
+struct TimeoutFixture {
+  DMapSetter dmapSetter;
+  TimeoutTestApp testApp{"ScriptedInitTimeoutApp"};
+  TestFacility testFacility{false};
+};
+
+BOOST_FIXTURE_TEST_CASE(testTimeout, TimeoutFixture) {
+  testFacility.runApplication();
+  auto initMessage = testFacility.getScalar<std::string>("/Devices/Dummy1/initScriptOutput");
+  auto initDuration = testFacility.getScalar<double>("/Devices/Dummy1/initScriptOutputDuration");
+
+  // two runs, each killed after the timeout
+  for(int i = 0; i < 2; ++i) {
+    initMessage.read();
+    std::string referenceString; // currently emtpy
+    BOOST_CHECK_EQUAL(static_cast<std::string>(initMessage), referenceString);
+
+    initMessage.read();
+    referenceString += "starting slow device init\n";
+    BOOST_CHECK_EQUAL(static_cast<std::string>(initMessage), referenceString);
+
+    initMessage.read();
+    referenceString += "!!! Dummy1 initialisation script killed after timeout of 1 seconds.\n";
+    referenceString += "!!! Dummy1 initialisation FAILED!";
+    BOOST_CHECK_EQUAL(static_cast<std::string>(initMessage), referenceString);
+
+    initDuration.read();
+    BOOST_CHECK(initDuration >= 1.);
+    BOOST_CHECK(initDuration < 10.);
+  }
+}
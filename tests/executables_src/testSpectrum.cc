@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testSpectrum
+
+#include "Application.h"
+#include "Spectrum.h"
+#include "TestFacility.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <random>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testFFTPlan) {
+  std::cout << "testFFTPlan" << std::endl;
+  std::mt19937 generator(42);
+  std::normal_distribution<double> distribution;
+
+  // compare against the naive DFT, for power-of-two lengths and other lengths (Bluestein)
+  for(size_t n : {1, 2, 3, 4, 5, 7, 8, 12, 16, 17, 100, 128, 1000, 1024}) {
+    std::vector<ctk::FFTPlan::Complex> x(n), workspace;
+    for(auto& v : x) v = {distribution(generator), distribution(generator)};
+
+    auto plan = ctk::FFTPlan::get(n);
+    BOOST_CHECK_EQUAL(plan->size(), n);
+    auto result = x;
+    plan->transform(result, workspace);
+
+    for(size_t k = 0; k < n; ++k) {
+      ctk::FFTPlan::Complex expected = 0;
+      for(size_t j = 0; j < n; ++j) expected += x[j] * std::polar(1., -2. * M_PI * double((j * k) % n) / double(n));
+      BOOST_CHECK_SMALL(std::abs(expected - result[k]), 1e-9);
+    }
+  }
+
+  // plans are cached
+  BOOST_CHECK(ctk::FFTPlan::get(100) == ctk::FFTPlan::get(100));
+}
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {}
+  ~TestApplication() override { shutdown(); }
+
+  ctk::Spectrum<double> spectrum{this, "Spectrum", "", 64};
+};
+
+/*********************************************************************************************************************/
+
+static std::vector<double> sine(double amplitude, double cycles, double offset = 0.) {
+  std::vector<double> values(64);
+  for(size_t i = 0; i < values.size(); ++i) {
+    values[i] = offset + amplitude * std::sin(2. * M_PI * cycles * double(i) / double(values.size()));
+  }
+  return values;
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testSpectrumModule) {
+  std::cout << "testSpectrumModule" << std::endl;
+  TestApplication app;
+  ctk::TestFacility test;
+  test.runApplication();
+
+  test.writeArray<double>("/Spectrum/input", sine(3., 5., 1.));
+  test.stepApplication();
+  auto amplitude = test.readArray<double>("/Spectrum/amplitude");
+  auto phase = test.readArray<double>("/Spectrum/phase");
+  BOOST_REQUIRE_EQUAL(amplitude.size(), 33);
+  BOOST_CHECK_CLOSE(amplitude[0], 1., 1e-6);
+  BOOST_CHECK_CLOSE(amplitude[5], 3., 1e-6);
+  BOOST_CHECK_CLOSE(phase[5], -M_PI / 2., 1e-6);
+  for(size_t k = 1; k < amplitude.size(); ++k) {
+    if(k != 5) BOOST_CHECK_SMALL(amplitude[k], 1e-9);
+  }
+
+  // with the Hann window, the peak leaks into the neighbouring bins
+  test.writeScalar<int32_t>("/Spectrum/config/window", 1);
+  test.writeArray<double>("/Spectrum/input", sine(3., 5.));
+  test.stepApplication();
+  amplitude = test.readArray<double>("/Spectrum/amplitude");
+  BOOST_CHECK_CLOSE(amplitude[5], 3., 1e-6);
+  BOOST_CHECK_CLOSE(amplitude[4], 1.5, 1e-6);
+  BOOST_CHECK_CLOSE(amplitude[6], 1.5, 1e-6);
+
+  // averaging of the power spectrum
+  test.writeScalar<int32_t>("/Spectrum/config/window", 0);
+  test.writeScalar<uint32_t>("/Spectrum/config/nAverages", 2);
+  test.writeArray<double>("/Spectrum/input", sine(2., 5.));
+  test.stepApplication();
+  amplitude = test.readArray<double>("/Spectrum/amplitude");
+  BOOST_CHECK_CLOSE(amplitude[5], 2., 1e-6);
+
+  test.writeArray<double>("/Spectrum/input", sine(4., 5.));
+  test.stepApplication();
+  amplitude = test.readArray<double>("/Spectrum/amplitude");
+  BOOST_CHECK_CLOSE(amplitude[5], std::sqrt((4. + 16.) / 2.), 1e-6);
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testStringInterner
+
+#include "StringInterner.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testIntern) {
+  std::cout << "testIntern" << std::endl;
+
+  auto id = ctk::StringInterner::intern("someName");
+  BOOST_CHECK_EQUAL(ctk::StringInterner::intern(std::string("some") + "Name"), id);
+  BOOST_CHECK_NE(ctk::StringInterner::intern("otherName"), id);
+  BOOST_CHECK_EQUAL(ctk::StringInterner::get(id), "someName");
+
+  // references stay valid while more strings are added
+  auto& name = ctk::StringInterner::get(id);
+  for(size_t i = 0; i < 10000; ++i) ctk::StringInterner::intern("name" + std::to_string(i));
+  BOOST_CHECK_EQUAL(name, "someName");
+
+  BOOST_CHECK_EQUAL(ctk::StringInterner::intern("."), ctk::StringInterner::dot);
+  BOOST_CHECK_EQUAL(ctk::StringInterner::intern(".."), ctk::StringInterner::dotDot);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testSplitPath) {
+  std::cout << "testSplitPath" << std::endl;
+
+  std::vector<ctk::StringInterner::Id> segments;
+  ctk::StringInterner::splitPath("/../some//path/./name/", segments);
+  BOOST_REQUIRE_EQUAL(segments.size(), 5);
+  BOOST_CHECK_EQUAL(segments[0], ctk::StringInterner::dotDot);
+  BOOST_CHECK_EQUAL(ctk::StringInterner::get(segments[1]), "some");
+  BOOST_CHECK_EQUAL(ctk::StringInterner::get(segments[2]), "path");
+  BOOST_CHECK_EQUAL(segments[3], ctk::StringInterner::dot);
+  BOOST_CHECK_EQUAL(ctk::StringInterner::get(segments[4]), "name");
+
+  // segments are appended
+  ctk::StringInterner::splitPath("name", segments);
+  BOOST_REQUIRE_EQUAL(segments.size(), 6);
+  BOOST_CHECK_EQUAL(segments[5], segments[4]);
+
+  segments.clear();
+  ctk::StringInterner::splitPath("", segments);
+  ctk::StringInterner::splitPath("//", segments);
+  BOOST_CHECK(segments.empty());
+}
+
+/*********************************************************************************************************************/
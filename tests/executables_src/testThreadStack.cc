@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testThreadStack
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ScalarAccessor.h"
+#include "ThreadStack.h"
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+/* Uses about depth kiB of stack */
+__attribute__((noinline)) int useStack(size_t depth) {
+  volatile char buffer[1024];
+  std::memset(const_cast<char*>(buffer), int(depth), sizeof(buffer));
+  if(depth == 0) return buffer[0];
+  return useStack(depth - 1) + buffer[1];
+}
+
+/*********************************************************************************************************************/
+
+struct TestModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int> input{this, "input", "", ""};
+
+  void mainLoop() override {
+    while(true) input.read();
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication() : Application("testSuite") {
+    setThreadStackSize(512 * 1024);
+    big.setThreadStackSize(2 * 1024 * 1024);
+  }
+  ~TestApplication() override { shutdown(); }
+
+  TestModule small{this, "small", ""};
+  TestModule big{this, "big", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testHighWaterMark) {
+  std::cout << "testHighWaterMark" << std::endl;
+
+  // Boost.Test assertions are not thread safe, so the checks are done after joining the thread
+  bool haveBounds = false;
+  size_t stackSize = 0, initial = 0, afterUse = 0, afterReturn = 0;
+  boost::thread::attributes attributes;
+  ctk::ThreadStack::setAttributes(attributes, 256 * 1024, 64 * 1024);
+  boost::thread thread(attributes, [&] {
+    ctk::ThreadStack::Bounds bounds;
+    haveBounds = ctk::ThreadStack::getCurrentBounds(bounds);
+    if(!haveBounds) return;
+    stackSize = bounds.end - bounds.begin;
+    ctk::ThreadStack::paintUnused(bounds);
+    initial = ctk::ThreadStack::getHighWaterMark(bounds);
+    useStack(100);
+    afterUse = ctk::ThreadStack::getHighWaterMark(bounds);
+    afterReturn = ctk::ThreadStack::getHighWaterMark(bounds);
+  });
+  thread.join();
+
+  BOOST_REQUIRE(haveBounds);
+  BOOST_CHECK_EQUAL(stackSize, 256 * 1024);
+  BOOST_CHECK_GT(initial, 0);
+  BOOST_CHECK_LT(initial, 64 * 1024);
+
+  // the high-water mark follows the deepest use of the stack and does not decrease afterwards
+  BOOST_CHECK_GE(afterUse, initial + 90 * 1024);
+  BOOST_CHECK_LT(afterUse, 256 * 1024);
+  BOOST_CHECK_EQUAL(afterReturn, afterUse);
+
+  // the stack of the main thread is not fixed
+  ctk::ThreadStack::Bounds bounds;
+  BOOST_CHECK(!ctk::ThreadStack::getCurrentBounds(bounds));
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testApplication) {
+  std::cout << "testApplication" << std::endl;
+  TestApplication app;
+  BOOST_CHECK_EQUAL(app.getThreadStackSize(), 512 * 1024);
+  BOOST_CHECK_EQUAL(app.big.getThreadStackSize(), 2 * 1024 * 1024);
+  BOOST_CHECK_EQUAL(app.small.getThreadStackSize(), 0);
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  // wait until both module threads have registered
+  std::vector<ctk::Application::ThreadStackUsage> usage;
+  for(size_t i = 0; i < 1000; ++i) {
+    usage = app.getThreadStackUsage();
+    if(std::count_if(usage.begin(), usage.end(), [](auto& u) { return u.name.substr(0, 3) == "AM_"; }) == 2) break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  size_t nFound = 0;
+  for(auto& thread : usage) {
+    if(thread.name == "AM_small") {
+      BOOST_CHECK_EQUAL(thread.stackSize, 512 * 1024);
+    }
+    else if(thread.name == "AM_big") {
+      BOOST_CHECK_EQUAL(thread.stackSize, 2 * 1024 * 1024);
+    }
+    else {
+      continue;
+    }
+    ++nFound;
+    BOOST_CHECK_GT(thread.highWaterMark, 0);
+    BOOST_CHECK_LT(thread.highWaterMark, thread.stackSize);
+  }
+  BOOST_CHECK_EQUAL(nFound, 2);
+
+  BOOST_CHECK_THROW(app.setThreadStackSize(1024 * 1024), ctk::logic_error);
+  BOOST_CHECK_THROW(app.small.setThreadStackSize(1024 * 1024), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
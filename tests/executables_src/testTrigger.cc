@@ -1,7 +1,9 @@
 // SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
 // SPDX-License-Identifier: LGPL-3.0-or-later
+#include <algorithm>
 #include <chrono>
 #include <future>
+#include <mutex>
 
 #define BOOST_TEST_MODULE testTrigger
 
@@ -48,9 +50,13 @@ class TestTransferGroupDummy : public ChimeraTK::DummyBackend {
     last_address = address;
     last_sizeInBytes = sizeInBytes;
     numberOfTransfers++;
+    std::lock_guard<std::mutex> lock(readMutex);
     DummyBackend::read(bar, address, data, sizeInBytes);
   }
 
+  // lock this mutex to block reads, e.g. to simulate slow transfers
+  std::mutex readMutex;
+
   std::atomic<size_t> numberOfTransfers{0};
   std::atomic<uint64_t> last_bar;
   std::atomic<uint64_t> last_address;
@@ -431,3 +437,138 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(testTriggerTransferGroup, T, test_types) {
 
   dev.close();
 }
+
+/*********************************************************************************************************************/
+/* test that stale triggers are skipped with TriggerOverrunPolicy::skipStale, and that the statistics are published */
+
+BOOST_AUTO_TEST_CASE(testTriggerOverrunSkipStale) {
+  std::cout << "***************************************************************"
+               "******************************************************"
+            << std::endl;
+  std::cout << "==> testTriggerOverrunSkipStale" << std::endl;
+
+  ChimeraTK::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  TestApplication<int32_t> app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+
+  auto backend = boost::dynamic_pointer_cast<TestTransferGroupDummy>(
+      ChimeraTK::BackendFactory::getInstance().createBackend(dummySdm));
+  BOOST_CHECK(backend != NULL);
+
+  app.dev2("/REG1")[app.testModule.theTrigger] >> app.testModule.consumingPush;
+  app.setTriggerOverrunPolicy(app.testModule.theTrigger, ctk::TriggerOverrunPolicy::skipStale, "/TriggerStatistics");
+  app.initialise();
+  app.run();
+  app.testModule.mainLoopStarted.wait(); // make sure the module's mainLoop() is entered
+
+  // from the inital value transfer
+  CHECK_TIMEOUT(backend->numberOfTransfers == 1, 10000);
+
+  // block the transfer of the next trigger and send more triggers in the meantime
+  backend->readMutex.lock();
+  app.testModule.theTrigger.write();
+  CHECK_TIMEOUT(backend->numberOfTransfers == 2, 10000);
+  app.testModule.theTrigger.write();
+  app.testModule.theTrigger.write();
+  app.testModule.theTrigger.write();
+  backend->readMutex.unlock();
+
+  // only the newest of the queued triggers is processed
+  CHECK_TIMEOUT(backend->numberOfTransfers == 3, 10000);
+  usleep(200000);
+  BOOST_CHECK_EQUAL(backend->numberOfTransfers, 3);
+
+  std::string alias = dummySdm;
+  std::replace(alias.begin(), alias.end(), '/', '_');
+  auto nOverruns = pvManagers.first->getProcessArray<uint64_t>("/TriggerStatistics/" + alias + "/nOverruns");
+  auto nSkippedTriggers =
+      pvManagers.first->getProcessArray<uint64_t>("/TriggerStatistics/" + alias + "/nSkippedTriggers");
+  auto cycleDuration = pvManagers.first->getProcessArray<double>("/TriggerStatistics/" + alias + "/cycleDuration");
+  BOOST_CHECK(nOverruns->readLatest());
+  BOOST_CHECK(nSkippedTriggers->readLatest());
+  BOOST_CHECK(cycleDuration->readLatest());
+  BOOST_CHECK_EQUAL(nOverruns->accessData(0), 1);
+  BOOST_CHECK_EQUAL(nSkippedTriggers->accessData(0), 2);
+  BOOST_CHECK_GE(cycleDuration->accessData(0), 0.);
+}
+
+/*********************************************************************************************************************/
+/* test that all overrun triggers are processed with TriggerOverrunPolicy::processAll, and that they are counted */
+
+BOOST_AUTO_TEST_CASE(testTriggerOverrunProcessAll) {
+  std::cout << "***************************************************************"
+               "******************************************************"
+            << std::endl;
+  std::cout << "==> testTriggerOverrunProcessAll" << std::endl;
+
+  ChimeraTK::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  TestApplication<int32_t> app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+
+  auto backend = boost::dynamic_pointer_cast<TestTransferGroupDummy>(
+      ChimeraTK::BackendFactory::getInstance().createBackend(dummySdm));
+  BOOST_CHECK(backend != NULL);
+
+  app.dev2("/REG1")[app.testModule.theTrigger] >> app.testModule.consumingPush;
+  app.setTriggerOverrunPolicy(
+      app.testModule.theTrigger, ctk::TriggerOverrunPolicy::processAll, "/Statistics/ProcessAll");
+  app.initialise();
+  app.run();
+  app.testModule.mainLoopStarted.wait(); // make sure the module's mainLoop() is entered
+
+  // from the inital value transfer
+  CHECK_TIMEOUT(backend->numberOfTransfers == 1, 10000);
+
+  // block the transfer of the next trigger and send more triggers in the meantime
+  backend->readMutex.lock();
+  app.testModule.theTrigger.write();
+  CHECK_TIMEOUT(backend->numberOfTransfers == 2, 10000);
+  app.testModule.theTrigger.write();
+  app.testModule.theTrigger.write();
+  app.testModule.theTrigger.write();
+  backend->readMutex.unlock();
+
+  // all queued triggers are processed, each of the first three cycles is overrun by the next trigger
+  CHECK_TIMEOUT(backend->numberOfTransfers == 5, 10000);
+  usleep(200000);
+  BOOST_CHECK_EQUAL(backend->numberOfTransfers, 5);
+
+  // the statistics are part of the connection model, i.e. published like any other output
+  std::string alias = dummySdm;
+  std::replace(alias.begin(), alias.end(), '/', '_');
+  auto nOverruns = pvManagers.first->getProcessArray<uint64_t>("/Statistics/ProcessAll/" + alias + "/nOverruns");
+  auto nSkippedTriggers =
+      pvManagers.first->getProcessArray<uint64_t>("/Statistics/ProcessAll/" + alias + "/nSkippedTriggers");
+  BOOST_REQUIRE(nOverruns);
+  BOOST_REQUIRE(nSkippedTriggers);
+  BOOST_CHECK(nOverruns->readLatest());
+  BOOST_CHECK(nSkippedTriggers->readLatest());
+  BOOST_CHECK_EQUAL(nOverruns->accessData(0), 3);
+  BOOST_CHECK_EQUAL(nSkippedTriggers->accessData(0), 0);
+}
+
+/*********************************************************************************************************************/
+/* test that an overrun policy for a node which does not trigger any device register is rejected */
+
+BOOST_AUTO_TEST_CASE(testTriggerOverrunPolicyUnused) {
+  std::cout << "***************************************************************"
+               "******************************************************"
+            << std::endl;
+  std::cout << "==> testTriggerOverrunPolicyUnused" << std::endl;
+
+  ChimeraTK::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+
+  TestApplication<int32_t> app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+
+  app.dev2("/REG1")[app.testModule.theTrigger] >> app.testModule.consumingPush;
+  app.setTriggerOverrunPolicy(app.testModule.feedingToDevice, ctk::TriggerOverrunPolicy::skipStale);
+  BOOST_CHECK_THROW(app.initialise(), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_MODULE testValidateConnections
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ArrayAccessor.h"
+#include "ScalarAccessor.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct TestModule : public ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<int32_t> input{this, "input", "", ""};
+  ctk::ScalarOutput<int32_t> output{this, "output", "", ""};
+  ctk::ArrayOutput<int32_t> array{this, "array", "", 10, ""};
+  ctk::ArrayPushInput<int32_t> shortArray{this, "shortArray", "", 5, ""};
+
+  void mainLoop() override {}
+};
+
+/*********************************************************************************************************************/
+
+struct TestApplication : public ctk::Application {
+  TestApplication(bool validModel) : Application("testSuite"), _validModel(validModel) {}
+  ~TestApplication() override { shutdown(); }
+
+  void defineConnections() override {
+    a.output >> b.input;
+    if(!_validModel) a.array >> b.shortArray;
+    Application::defineConnections();
+  }
+
+  bool _validModel;
+
+  TestModule a{this, "A", ""};
+  TestModule b{this, "B", ""};
+};
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testValidModel) {
+  std::cout << "testValidModel" << std::endl;
+  TestApplication app(true);
+  BOOST_CHECK_NO_THROW(app.validateConnections());
+
+  // the model is only defined once, so neither a second validation nor an initialisation is possible afterwards
+  BOOST_CHECK_THROW(app.validateConnections(), ctk::logic_error);
+  BOOST_CHECK_THROW(app.initialise(), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidModel) {
+  std::cout << "testInvalidModel" << std::endl;
+  TestApplication app(false);
+  BOOST_CHECK_THROW(app.validateConnections(), ctk::logic_error);
+}
+
+/*********************************************************************************************************************/